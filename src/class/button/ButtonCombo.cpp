@@ -0,0 +1,123 @@
+#include "ButtonCombo.h"
+
+ButtonComboEngine::ButtonComboEngine() {
+    table = nullptr;
+    count = 0;
+    for (uint8_t i = 0; i < MAX_COMBOS; i++) {
+        chordSince[i] = 0;
+        chordHeld[i] = ButtonCombo::NO_BUTTON;
+    }
+    chordFired = 0;
+    chordMembers = 0;
+    historyCount = 0;
+    heldBack = 0;
+    forwarded = 0;
+    matches = 0;
+}
+
+void ButtonComboEngine::setTable(const ButtonCombo* table, uint8_t count) {
+    this->table = table;
+    this->count = count > MAX_COMBOS ? MAX_COMBOS : count;
+}
+
+uint8_t ButtonComboEngine::onPress(uint8_t buttonId, uint8_t pressedMask, int64_t timeUs) {
+    // 최근 누름에 추가 (한 칸씩 밀기)
+    for (uint8_t i = 0; i + 1 < ButtonCombo::MAX_STEPS; i++) {
+        history[i] = history[i + 1];
+        historyUs[i] = historyUs[i + 1];
+    }
+    history[ButtonCombo::MAX_STEPS - 1] = buttonId;
+    historyUs[ButtonCombo::MAX_STEPS - 1] = timeUs;
+    if (historyCount < ButtonCombo::MAX_STEPS) historyCount++;
+    
+    uint8_t action = NO_ACTION;
+    for (uint8_t i = 0; i < count; i++) {
+        const ButtonCombo& combo = table[i];
+        
+        if (combo.type == ButtonCombo::CHORD) {
+            // 이 누름으로 마스크가 모두 눌림 → 마지막 버튼 감춤, 유지 시간은 지금부터
+            // (유지 시간 전에 풀리면 resetChord() 가 감춘 누름을 돌려줌)
+            if ((pressedMask & combo.mask) == combo.mask && chordSince[i] == 0) {
+                chordSince[i] = timeUs;
+                chordMembers |= combo.mask;
+                chordHeld[i] = buttonId;
+                heldBack |= 1 << buttonId;
+            }
+        } else if (action == NO_ACTION && matchSequence(combo)) {
+            action = combo.action;
+            heldBack |= 1 << buttonId;
+            historyCount = 0;       // 같은 누름으로 다시 완성되지 않도록
+            matches++;
+        }
+    }
+    return action;
+}
+
+// 최근 누름 끝부분 = 단계 순서, 누름 간격 모두 windowMs 이내
+bool ButtonComboEngine::matchSequence(const ButtonCombo& combo) const {
+    if (historyCount < combo.length) return false;
+    
+    uint8_t start = ButtonCombo::MAX_STEPS - combo.length;
+    int64_t windowUs = (int64_t)combo.timeMs * 1000;
+    for (uint8_t i = 0; i < combo.length; i++) {
+        if (history[start + i] != combo.steps[i]) return false;
+        if (i > 0 && historyUs[start + i] - historyUs[start + i - 1] > windowUs) return false;
+    }
+    return true;
+}
+
+bool ButtonComboEngine::onRelease(uint8_t buttonId) {
+    uint8_t bit = 1 << buttonId;
+    
+    // 이 버튼이 들어간 동시 누름은 여기서 끝 (update() 보다 먼저: 감춘 버튼 자신의 릴리스도 내보내도록)
+    for (uint8_t i = 0; i < count; i++) {
+        if (table[i].type == ButtonCombo::CHORD && (table[i].mask & bit) && chordSince[i] != 0) {
+            resetChord(i);
+        }
+    }
+    
+    bool held = heldBack & bit;
+    heldBack &= ~bit;
+    return held;
+}
+
+uint8_t ButtonComboEngine::update(uint8_t pressedMask, int64_t nowUs) {
+    uint8_t action = NO_ACTION;
+    uint8_t members = 0;
+    
+    for (uint8_t i = 0; i < count; i++) {
+        const ButtonCombo& combo = table[i];
+        if (combo.type != ButtonCombo::CHORD) continue;
+        
+        uint8_t bit = 1 << i;
+        if ((pressedMask & combo.mask) != combo.mask) {
+            // 하나라도 놓으면 다시 처음부터
+            if (chordSince[i] != 0) resetChord(i);
+            continue;
+        }
+        
+        members |= combo.mask;
+        if (chordSince[i] == 0) chordSince[i] = nowUs;
+        if (!(chordFired & bit) && nowUs - chordSince[i] >= (int64_t)combo.timeMs * 1000) {
+            chordFired |= bit;
+            matches++;
+            if (action == NO_ACTION) action = combo.action;
+        }
+    }
+    
+    chordMembers = members;
+    return action;
+}
+
+// 동시 누름 끝: 발생 전이면 감춘 누름을 돌려줌 (발생 후면 릴리스까지 계속 감춤)
+void ButtonComboEngine::resetChord(uint8_t index) {
+    uint8_t held = chordHeld[index];
+    if (held != ButtonCombo::NO_BUTTON && !(chordFired & (1 << index))) {
+        heldBack &= ~(1 << held);
+        forwarded |= 1 << held;
+    }
+    chordHeld[index] = ButtonCombo::NO_BUTTON;
+    chordSince[index] = 0;
+    chordFired &= ~(1 << index);
+    chordMembers &= ~table[index].mask;
+}
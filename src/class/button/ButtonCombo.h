@@ -0,0 +1,105 @@
+#ifndef BUTTON_COMBO_H
+#define BUTTON_COMBO_H
+
+#include <stdint.h>
+
+// 버튼 조합 표 항목 (constexpr 로 만들어 플래시 상수 표로 둔다)
+//   CHORD   : mask 버튼을 동시에 holdMs 이상 누름
+//   SEQUENCE: steps 버튼을 차례로 누름 (누름 간격 windowMs 이내)
+// 예)
+//   static constexpr ButtonCombo COMBOS[] = {
+//       ButtonCombo::chord(ACTION_SETTINGS, MASK_SELECT | MASK_LEFT | MASK_RIGHT, 1000),
+//       ButtonCombo::sequence(ACTION_STATS, 600, BTN_UP, BTN_UP, BTN_DOWN),
+//   };
+struct ButtonCombo {
+    static const uint8_t MAX_STEPS = 4;
+    static const uint8_t NO_BUTTON = 0xFF;
+    
+    enum Type : uint8_t {
+        CHORD,
+        SEQUENCE
+    };
+    
+    Type type;
+    uint8_t action;             // 동작 ID (0 = 없음)
+    uint8_t mask;               // CHORD: 버튼 마스크 (bit i = 버튼 i)
+    uint8_t length;             // SEQUENCE: 단계 수
+    uint16_t timeMs;            // CHORD: 유지 시간, SEQUENCE: 누름 간격 최대
+    uint8_t steps[MAX_STEPS];   // SEQUENCE: 버튼 ID 순서
+    
+    static constexpr ButtonCombo chord(uint8_t action, uint8_t mask, uint16_t holdMs) {
+        return { CHORD, action, mask, 0, holdMs, { NO_BUTTON, NO_BUTTON, NO_BUTTON, NO_BUTTON } };
+    }
+    
+    static constexpr ButtonCombo sequence(uint8_t action, uint16_t windowMs, uint8_t s0, uint8_t s1,
+                                          uint8_t s2 = NO_BUTTON, uint8_t s3 = NO_BUTTON) {
+        return { SEQUENCE, action,
+                 (uint8_t)((1 << s0) | (1 << s1) | (s2 != NO_BUTTON ? 1 << s2 : 0) | (s3 != NO_BUTTON ? 1 << s3 : 0)),
+                 (uint8_t)(s2 == NO_BUTTON ? 2 : (s3 == NO_BUTTON ? 3 : 4)),
+                 windowMs, { s0, s1, s2, s3 } };
+    }
+};
+
+// 조합 판정 (Arduino 의존 없음, 호스트 빌드 가능)
+// - 동시 누름은 scan 마다 update() 1회: 조합당 마스크 비교 1번
+// - 순서는 누름마다 onPress(): 최근 누름 MAX_STEPS 개와 비교 (조합당 최대 4번)
+// - 조합을 완성한 누름은 감춤(held back): 그 버튼의 눌림/롱프레스/릴리스 이벤트를 놓을 때까지 내보내지 않음
+//   이미 내보낸 누름의 릴리스는 감추지 않음 (받는 쪽 눌림 상태가 남지 않도록)
+// - 동시 누름이 유지 시간 전에 풀리면(하나라도 놓음) 감췄던 누름을 돌려줌: takeForwarded() 로 받아 늦게 내보냄
+class ButtonComboEngine {
+public:
+    static const uint8_t MAX_COMBOS = 8;
+    static const uint8_t NO_ACTION = 0;
+    
+    ButtonComboEngine();
+    
+    void setTable(const ButtonCombo* table, uint8_t count);
+    
+    // 디바운스된 누름 1회 (pressedMask 는 이 버튼 포함), 순서 조합이 완성되면 동작 ID
+    uint8_t onPress(uint8_t buttonId, uint8_t pressedMask, int64_t timeUs);
+    
+    // 놓음 1회, 반환: 이 릴리스를 감춰야 하면 true (눌림을 감췄던 버튼)
+    // 유지 시간 전에 풀린 동시 누름의 감춘 누름은 감춤을 풀고 takeForwarded() 로 넘김
+    bool onRelease(uint8_t buttonId);
+    
+    // 감춤이 풀려 지금 내보내야 할 누름 (bit i = 버튼 i), 읽으면 비움
+    // onRelease() / update() 뒤에 확인 (같은 버튼의 릴리스보다 먼저 눌림을 내보낼 것)
+    uint8_t takeForwarded() {
+        uint8_t mask = forwarded;
+        forwarded = 0;
+        return mask;
+    }
+    
+    // scan 마다 1회: 동시 누름 유지 시간이 된 조합의 동작 ID (누르는 동안 한 번)
+    uint8_t update(uint8_t pressedMask, int64_t nowUs);
+    
+    // 눌림 이벤트를 감춘 버튼 / 조합에 쓰이는 중이라 롱프레스를 감출 버튼
+    bool isHeldBack(uint8_t buttonId) const { return (heldBack >> buttonId) & 1; }
+    bool isInCombo(uint8_t buttonId) const { return ((heldBack | chordMembers) >> buttonId) & 1; }
+    
+    uint32_t getMatches() const { return matches; }
+    
+private:
+    const ButtonCombo* table;
+    uint8_t count;
+    
+    // 동시 누름 상태 (표 순서)
+    int64_t chordSince[MAX_COMBOS];     // 마스크가 모두 눌린 시각 (0 = 아님)
+    uint8_t chordFired;                 // bit i = 표 i 번 이번 누름에 발생함
+    uint8_t chordMembers;               // 모두 눌린 조합들의 버튼
+    uint8_t chordHeld[MAX_COMBOS];      // 조합을 완성해 감춘 버튼 (NO_BUTTON = 없음)
+    
+    // 최근 누름 (순서 조합용, [MAX_STEPS-1] 이 최신)
+    uint8_t history[ButtonCombo::MAX_STEPS];
+    int64_t historyUs[ButtonCombo::MAX_STEPS];
+    uint8_t historyCount;
+    
+    uint8_t heldBack;       // 눌림을 감춘 버튼 (놓을 때까지)
+    uint8_t forwarded;      // 감춤이 풀려 늦게 내보낼 누름
+    uint32_t matches;
+    
+    bool matchSequence(const ButtonCombo& combo) const;
+    void resetChord(uint8_t index);
+};
+
+#endif // BUTTON_COMBO_H
@@ -0,0 +1,92 @@
+#include "ButtonGesture.h"
+
+ButtonGesture::ButtonGesture() {
+    state = STATE_IDLE;
+    clicks = 0;
+    longSent = false;
+    pressUs = 0;
+    releaseUs = 0;
+    repeatCount = 0;
+    nextRepeatUs = 0;
+    repeatIntervalUs = 0;
+}
+
+ButtonGesture::Gesture ButtonGesture::onPress(int64_t timeUs, const Timing& timing) {
+    Gesture result = NONE;
+
+    if (state == STATE_CLICK_WAIT) {
+        if (timeUs - releaseUs <= (int64_t)timing.doubleClickMs * 1000) {
+            result = DOUBLE_CLICK;
+        } else {
+            result = CLICK;     // 대기 시간이 지난 앞 클릭 (에지가 한꺼번에 처리된 경우)
+        }
+    }
+
+    clicks = (result == DOUBLE_CLICK) ? 2 : 1;
+    state = STATE_DOWN;
+    longSent = false;
+    pressUs = timeUs;
+    repeatCount = 0;
+
+    return result;
+}
+
+void ButtonGesture::onRelease(int64_t timeUs) {
+    if (state != STATE_DOWN) return;
+
+    // 롱프레스/반복이 나간 누름, 더블클릭의 두 번째 누름은 클릭이 아님
+    if (clicks == 1 && !longSent && repeatCount == 0) {
+        state = STATE_CLICK_WAIT;
+        releaseUs = timeUs;
+    } else {
+        state = STATE_IDLE;
+    }
+}
+
+ButtonGesture::Gesture ButtonGesture::update(int64_t nowUs, bool repeat, const Timing& timing) {
+    if (state == STATE_CLICK_WAIT) {
+        if (nowUs - releaseUs > (int64_t)timing.doubleClickMs * 1000) {
+            state = STATE_IDLE;
+            return CLICK;
+        }
+        return NONE;
+    }
+
+    if (state != STATE_DOWN) return NONE;
+
+    int64_t heldUs = nowUs - pressUs;
+
+    if (repeatCount > 0 && !repeat) return NONE;   // 반복 중 대상에서 빠짐 (설정 모드 종료 등)
+    if (repeat) {
+        if (repeatCount == 0) {
+            if (heldUs < (int64_t)timing.repeatDelayMs * 1000) return NONE;
+            repeatIntervalUs = (int64_t)timing.repeatIntervalMs * 1000;
+            nextRepeatUs = pressUs + (int64_t)timing.repeatDelayMs * 1000;
+        }
+        if (nowUs < nextRepeatUs) return NONE;
+
+        repeatCount++;
+        nextRepeatUs += repeatIntervalUs;
+        if (nextRepeatUs < nowUs) {
+            nextRepeatUs = nowUs + repeatIntervalUs;    // loop 가 멈췄던 만큼 몰아서 내보내지 않음
+        }
+
+        // 가속: 반복마다 간격 3/4
+        int64_t minUs = (int64_t)timing.repeatMinMs * 1000;
+        repeatIntervalUs = repeatIntervalUs * 3 / 4;
+        if (repeatIntervalUs < minUs) repeatIntervalUs = minUs;
+        return REPEAT;
+    }
+
+    if (!longSent && heldUs >= (int64_t)timing.longPressMs * 1000) {
+        longSent = true;
+        return LONG_PRESS;
+    }
+
+    return NONE;
+}
+
+void ButtonGesture::cancel() {
+    state = STATE_IDLE;
+    repeatCount = 0;
+}
@@ -0,0 +1,71 @@
+#ifndef BUTTON_GESTURE_H
+#define BUTTON_GESTURE_H
+
+#include <stdint.h>
+
+// 버튼 1개 제스처 판정 (Arduino 의존 없음, 호스트 빌드 가능)
+// 입력은 디바운스된 눌림/놓음의 에지 시각(us) - loop() 가 늦어도 실제 누른 간격으로 판정
+//   CLICK       : 짧게 눌렀다 놓고 더블클릭 시간 안에 다시 누르지 않음 (시간이 지난 뒤 확정)
+//   DOUBLE_CLICK: 짧은 클릭 뒤 더블클릭 시간 안에 다시 누름 (두 번째 누름 즉시, 기다리지 않음)
+//   LONG_PRESS  : 누른 시각부터 롱프레스 시간, 누르는 동안 한 번
+//   REPEAT      : 반복 켜진 버튼을 누르고 있으면 지연 후 반복, 간격은 반복마다 3/4 로 줄어듦 (최소 간격까지)
+// 눌림/릴리스 이벤트는 RemoteButton 이 따로 바로 보냄 (제스처는 그 위에 덧붙는 이벤트)
+class ButtonGesture {
+public:
+    enum Gesture : uint8_t {
+        NONE = 0,
+        CLICK,
+        DOUBLE_CLICK,
+        LONG_PRESS,
+        REPEAT
+    };
+
+    // 버튼 공통 시간 설정 (ms)
+    struct Timing {
+        uint16_t doubleClickMs;     // 놓은 뒤 다시 누를 때까지
+        uint16_t longPressMs;
+        uint16_t repeatDelayMs;     // 누른 뒤 첫 반복까지
+        uint16_t repeatIntervalMs;  // 첫 반복 간격
+        uint16_t repeatMinMs;       // 가속 후 최소 간격
+    };
+
+    ButtonGesture();
+
+    // 디바운스된 누름 1회 - 더블클릭이면 DOUBLE_CLICK,
+    // 앞 클릭의 대기 시간이 이미 지났는데 update() 보다 이 누름이 먼저 오면 그 CLICK
+    Gesture onPress(int64_t timeUs, const Timing& timing);
+
+    // 디바운스된 놓음 1회 (짧은 첫 클릭이면 더블클릭 대기 시작)
+    void onRelease(int64_t timeUs);
+
+    // scan 마다 1회: 확정된 CLICK / LONG_PRESS / REPEAT (한 번에 하나)
+    // repeat = 이 버튼이 지금 반복 대상인지 (반복 대상이면 롱프레스 대신 반복)
+    Gesture update(int64_t nowUs, bool repeat, const Timing& timing);
+
+    // 이번 누름의 제스처 취소 (조합에 쓰인 버튼 등), 다음 누름부터 다시 판정
+    void cancel();
+
+    bool isHeld() const { return state == STATE_DOWN; }
+    int64_t getPressUs() const { return pressUs; }
+    uint16_t getRepeatCount() const { return repeatCount; }
+
+private:
+    enum State : uint8_t {
+        STATE_IDLE,
+        STATE_DOWN,         // 누르는 중 (clicks = 이번이 몇 번째 누름)
+        STATE_CLICK_WAIT    // 짧은 클릭 후 두 번째 누름 대기
+    };
+
+    State state;
+    uint8_t clicks;
+    bool longSent;
+    int64_t pressUs;
+    int64_t releaseUs;
+
+    // 반복
+    uint16_t repeatCount;
+    int64_t nextRepeatUs;
+    int64_t repeatIntervalUs;
+};
+
+#endif // BUTTON_GESTURE_H
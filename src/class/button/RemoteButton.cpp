@@ -3,21 +3,44 @@
 #include "../espnow/RemoteESPNow.h"
 #include "../cancom/RemoteCANCom.h"
 
+// 버튼 ID 순서 핀 번호 (모두 GPIO 0~31 → GPIO_IN_REG 한 번으로 읽힘)
+const uint8_t RemoteButton::BUTTON_PINS[BUTTON_COUNT] = {
+    PIN_BTN_SELECT, PIN_BTN_DOWN, PIN_BTN_RIGHT, PIN_BTN_LEFT, PIN_BTN_UP
+};
+
+// 버튼 조합 표: 동시 누름은 scan 마다 마스크 비교 1번, 순서는 누름마다 최근 누름과 비교
+// 조합을 완성한 누름은 개별 이벤트로 내보내지 않음 (ButtonComboEngine 참고)
+static constexpr ButtonCombo COMBO_TABLE[] = {
+    ButtonCombo::chord(RemoteButton::COMBO_SETTINGS_MODE,
+                       (1 << RemoteButton::BTN_SELECT) | (1 << RemoteButton::BTN_LEFT) | (1 << RemoteButton::BTN_RIGHT), 1000),
+    ButtonCombo::sequence(RemoteButton::COMBO_PRINT_STATS, 600,
+                          RemoteButton::BTN_UP, RemoteButton::BTN_UP, RemoteButton::BTN_DOWN),
+};
+
 RemoteButton::RemoteButton() {
     debounceTime = 50;          // 50ms 디바운스
     longPressTime = 1000;       // 1초 롱프레스
     doubleClickTime = 300;      // 300ms 더블클릭
     
-    eventQueueHead = 0;
-    eventQueueTail = 0;
-    lastButtonState = 0x1F;     // 5개 버튼 릴리스 상태 (풀업)
+    gestureTiming.doubleClickMs = 300;
+    gestureTiming.longPressMs = 1000;
+    gestureTiming.repeatDelayMs = 400;      // 0.4초 누르고 있으면 반복 시작
+    gestureTiming.repeatIntervalMs = 150;   // 150ms → 반복마다 3/4 → 최소 30ms
+    gestureTiming.repeatMinMs = 30;
+    repeatMask = 0;
+    
+    pressedMask = 0;            // 5개 버튼 릴리스 상태
+    lastSampleUs = 0;
     
     pLcd = nullptr;
     pEspNow = nullptr;
     pCanCom = nullptr;
     
-    tripleButtonPressStart = 0;
-    settingsModeRequested = false;
+    combos.setTable(COMBO_TABLE, sizeof(COMBO_TABLE) / sizeof(COMBO_TABLE[0]));
+    
+    interruptMode = false;
+    edgeDroppedSeen = 0;
+    memset(&inputStats, 0, sizeof(inputStats));
     
     // 버튼 상태 초기화
     for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
@@ -26,6 +49,14 @@ RemoteButton::RemoteButton() {
         buttons[i].wasPressed = false;
         buttons[i].pressTime = 0;
         buttons[i].releaseTime = 0;
+        buttons[i].rawPressed = false;
+        buttons[i].rawUs = 0;
+        buttons[i].changeUs = 0;
+        buttons[i].pressUs = 0;
+        
+        edgeSources[i].owner = this;
+        edgeSources[i].buttonId = i;
+        edgeSources[i].pin = BUTTON_PINS[i];
     }
 }
 
@@ -37,6 +68,22 @@ bool RemoteButton::begin() {
     pinMode(PIN_BTN_LEFT, INPUT_PULLUP);    // LEFT
     pinMode(PIN_BTN_UP, INPUT_PULLUP);      // UP
     
+    // 시작 시 이미 눌려 있는 버튼 (인터럽트는 다음 변화부터)
+    uint8_t mask = readButtonMask();
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        buttons[i].rawPressed = (mask >> i) & 1;
+        buttons[i].rawUs = esp_timer_get_time();
+    }
+    
+#if BUTTON_INPUT_ISR
+    // 핀 변화마다 시각 기록
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        attachInterruptArg(edgeSources[i].pin, onEdgeIsr, &edgeSources[i], CHANGE);
+    }
+    interruptMode = true;
+    printf("버튼 입력: GPIO 인터럽트 (에지 큐 %u)\r\n", (unsigned)edgeQueue.capacity());
+#endif
+    
     printf("12512WS-08 버튼 초기화 완료 (5개)\r\n");
     printf("버튼 매핑:\r\n");
     printf("  SELECT(중앙): GPIO 12\r\n");
@@ -44,18 +91,108 @@ bool RemoteButton::begin() {
     printf("  RIGHT: GPIO 14\r\n");
     printf("  LEFT: GPIO 27\r\n");
     printf("  UP: GPIO 26\r\n");
-    printf("설정 모드: SELECT + LEFT + RIGHT 동시 누름\r\n");
+    printf("설정 모드: SELECT + LEFT + RIGHT 동시 누름 (설정 모드에서 방향 버튼 누르고 있으면 반복)\r\n");
     
     return true;
 }
 
 void RemoteButton::scan() {
+    int64_t now = esp_timer_get_time();
+    
+    // 이전 상태 저장
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        buttons[i].wasPressed = buttons[i].isPressed;
+    }
+    
+    // 설정 모드에서만 방향 버튼 반복 (주행 중 누르고 있는 버튼은 그대로 눌림 유지)
+    repeatMask = (pCanCom && pCanCom->isInSettingsMode()) ? REPEAT_BUTTONS : 0;
+    
+    if (interruptMode) {
+        drainEdges(now);
+    } else {
+        scanPort(now);
+    }
+    
     for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
-        processButton(i);
+        processButton(i, now);
+    }
+    
+    // 동시 누름 조합 (조합당 마스크 비교 1번)
+    uint8_t action = combos.update(pressedMask, now);
+    if (action != ButtonComboEngine::NO_ACTION) {
+        addComboEvent(action, now);
     }
+    forwardPresses();
+}
+
+// 핀 변화 인터럽트: 시각 + 레벨만 큐에 넣고 끝 (디바운스는 loop 쪽)
+void IRAM_ATTR RemoteButton::onEdgeIsr(void* arg) {
+    EdgeSource* source = (EdgeSource*)arg;
+    RemoteButton* self = source->owner;
     
-    // 설정 모드 콤보 확인
-    checkSettingsModeCombo();
+    ButtonEdge edge;
+    edge.timeUs = esp_timer_get_time();
+    edge.buttonId = source->buttonId;
+    edge.pressed = ((REG_READ(GPIO_IN_REG) >> source->pin) & 1) == 0;
+    
+    self->edgeQueue.push(edge);     // 가득 차면 큐가 버린 수를 셈
+}
+
+void RemoteButton::drainEdges(int64_t nowUs) {
+    ButtonEdge edge;
+    while (edgeQueue.pop(edge)) {
+        uint32_t latency = (uint32_t)(nowUs - edge.timeUs);
+        inputStats.lastLatencyUs = latency;
+        if (latency > inputStats.worstLatencyUs) {
+            inputStats.worstLatencyUs = latency;
+        }
+        onEdge(edge.buttonId, edge.pressed, edge.timeUs);
+    }
+    
+    // 큐가 넘쳐 에지를 잃었으면 실제 핀 레벨로 맞춤
+    uint32_t dropped = edgeQueue.getDropped();
+    if (dropped != edgeDroppedSeen) {
+        inputStats.dropped += dropped - edgeDroppedSeen;
+        edgeDroppedSeen = dropped;
+        pollButtons(nowUs);
+    }
+}
+
+// 레벨이 바뀐 핀을 지금 시각의 에지로 (에지 큐 복구용)
+void RemoteButton::pollButtons(int64_t nowUs) {
+    uint8_t mask = readButtonMask();
+    for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+        bool level = (mask >> i) & 1;
+        if (level != buttons[i].rawPressed) {
+            onEdge(i, level, nowUs);
+        }
+    }
+}
+
+// 5개 핀을 입력 레지스터 1회 읽기로 (풀업: LOW = 눌림), bit i = 버튼 i
+uint8_t RemoteButton::readButtonMask() {
+    uint32_t in = ~REG_READ(GPIO_IN_REG);
+    return (uint8_t)((((in >> PIN_BTN_SELECT) & 1) << BTN_SELECT) |
+                     (((in >> PIN_BTN_DOWN) & 1) << BTN_DOWN) |
+                     (((in >> PIN_BTN_RIGHT) & 1) << BTN_RIGHT) |
+                     (((in >> PIN_BTN_LEFT) & 1) << BTN_LEFT) |
+                     (((in >> PIN_BTN_UP) & 1) << BTN_UP));
+}
+
+// 세로 카운터 디바운스: 5개 버튼을 한꺼번에, 안정 상태와 다른 표본이 4번 연속이면 상태 반전
+void RemoteButton::scanPort(int64_t nowUs) {
+    // 표본 간격 = 디바운스 시간 / 4 (loop 가 더 자주 불러도 디바운스 시간 유지)
+    if (nowUs - lastSampleUs < (int64_t)debounceTime * 1000 / VerticalCounter::SAMPLES) return;
+    lastSampleUs = nowUs;
+    
+    uint8_t sample = readButtonMask();
+    uint8_t changed = debouncer.update(sample, pressedMask);
+    
+    for (uint8_t i = 0; changed; i++, changed >>= 1) {
+        if (changed & 1) {
+            setButtonState(i, (sample >> i) & 1, nowUs);
+        }
+    }
 }
 
 bool RemoteButton::isButtonPressed(uint8_t buttonId) {
@@ -82,17 +219,12 @@ bool RemoteButton::wasButtonJustReleased(uint8_t buttonId) {
 }
 
 bool RemoteButton::hasEvent() {
-    return eventQueueHead != eventQueueTail;
+    return !eventQueue.isEmpty();
 }
 
 ButtonEventInfo RemoteButton::getEvent() {
-    ButtonEventInfo event = {0, BUTTON_NONE, 0};
-    
-    if (hasEvent()) {
-        event = eventQueue[eventQueueHead];
-        eventQueueHead = (eventQueueHead + 1) % 20;
-    }
-    
+    ButtonEventInfo event = {0, BUTTON_NONE, 0, 0, 0};
+    eventQueue.pop(event);
     return event;
 }
 
@@ -102,143 +234,198 @@ void RemoteButton::setDebounceTime(unsigned long ms) {
 
 void RemoteButton::setLongPressTime(unsigned long ms) {
     longPressTime = ms;
+    gestureTiming.longPressMs = (uint16_t)ms;
 }
 
 void RemoteButton::setDoubleClickTime(unsigned long ms) {
     doubleClickTime = ms;
+    gestureTiming.doubleClickMs = (uint16_t)ms;
+}
+
+void RemoteButton::setRepeatTime(uint16_t delayMs, uint16_t intervalMs, uint16_t minIntervalMs) {
+    gestureTiming.repeatDelayMs = delayMs;
+    gestureTiming.repeatIntervalMs = intervalMs;
+    gestureTiming.repeatMinMs = minIntervalMs;
 }
 
 void RemoteButton::addEvent(ButtonEventInfo event) {
-    uint8_t nextTail = (eventQueueTail + 1) % 20;
-    
-    // 큐가 가득 차지 않았으면 추가
-    if (nextTail != eventQueueHead) {
-        eventQueue[eventQueueTail] = event;
-        eventQueueTail = nextTail;
+    if (!eventQueue.push(event)) {
+        // 처리가 밀려 가득 참 (버린 수는 큐가 셈)
+        printf("버튼 이벤트 큐 가득 참 - 버튼 %d 이벤트 %d 버림\r\n", event.buttonId, event.event);
     }
+    inputStats.eventsDropped = eventQueue.getDropped();
+    inputStats.eventHighWater = eventQueue.getHighWater();
 }
 
-bool RemoteButton::readButton(uint8_t buttonId) {
-    if (buttonId >= BUTTON_COUNT) return false;
-    
-    uint8_t pin = getPinForButton(buttonId);
-    // LOW = 눌림 (풀업)
-    return digitalRead(pin) == LOW;
+bool RemoteButton::areButtonsPressed(uint8_t btn1, uint8_t btn2, uint8_t btn3) {
+    return isComboPressed(buttonMask(btn1) | buttonMask(btn2) | buttonMask(btn3));
 }
 
-uint8_t RemoteButton::getPinForButton(uint8_t buttonId) {
-    switch (buttonId) {
-        case BTN_SELECT: return PIN_BTN_SELECT;
-        case BTN_DOWN: return PIN_BTN_DOWN;
-        case BTN_RIGHT: return PIN_BTN_RIGHT;
-        case BTN_LEFT: return PIN_BTN_LEFT;
-        case BTN_UP: return PIN_BTN_UP;
-        default: return 0;
-    }
+void RemoteButton::addComboEvent(uint8_t action, int64_t timeUs) {
+    ButtonEventInfo event;
+    event.buttonId = action;
+    event.event = BUTTON_COMBO;
+    event.duration = 0;
+    event.timeUs = timeUs;
+    event.count = 0;
+    addEvent(event);
 }
 
-bool RemoteButton::areButtonsPressed(uint8_t btn1, uint8_t btn2, uint8_t btn3) {
-    return readButton(btn1) && readButton(btn2) && readButton(btn3);
+// 제스처 → 이벤트 (시각은 제스처를 만든 에지 시각)
+void RemoteButton::addGestureEvent(uint8_t buttonId, ButtonGesture::Gesture gesture, int64_t timeUs) {
+    ButtonGesture& g = gestures[buttonId];
+    
+    ButtonEventInfo event;
+    event.buttonId = buttonId;
+    event.timeUs = timeUs;
+    event.duration = 0;
+    event.count = 0;
+    
+    switch (gesture) {
+        case ButtonGesture::CLICK:
+            event.event = BUTTON_CLICK;
+            break;
+        case ButtonGesture::DOUBLE_CLICK:
+            event.event = BUTTON_DOUBLE_CLICK;
+            printf("버튼 %d 더블클릭\r\n", buttonId);
+            break;
+        case ButtonGesture::LONG_PRESS:
+            event.event = BUTTON_LONG_PRESS;
+            event.duration = (unsigned long)((timeUs - g.getPressUs()) / 1000);
+            event.timeUs = g.getPressUs();
+            printf("버튼 %d 롱프레스 감지\r\n", buttonId);
+            break;
+        case ButtonGesture::REPEAT:
+            event.event = BUTTON_REPEAT;
+            event.duration = (unsigned long)((timeUs - g.getPressUs()) / 1000);
+            event.count = g.getRepeatCount();
+            break;
+        default:
+            return;
+    }
+    addEvent(event);
 }
 
-void RemoteButton::checkSettingsModeCombo() {
-    // SELECT + LEFT + RIGHT 동시 누름 확인
-    if (areButtonsPressed(BTN_SELECT, BTN_LEFT, BTN_RIGHT)) {
-        if (tripleButtonPressStart == 0) {
-            tripleButtonPressStart = millis();
-        } else if (millis() - tripleButtonPressStart > 1000 && !settingsModeRequested) {
-            // 1초 이상 눌림 -> 설정 모드 진입
-            settingsModeRequested = true;
-            printf("=== 설정 모드 콤보 감지 ===\r\n");
-            
-            if (pCanCom) {
-                pCanCom->enterSettingsMode();
-            }
-            
-            if (pLcd) {
-                pLcd->clear();
-                pLcd->setTextSize(2);
-                pLcd->printTextCentered("설정 모드", 10, RemoteLCD::CYAN);
-                pLcd->setTextSize(1);
-                pLcd->printTextCentered("CAN 연결 중...", 40, RemoteLCD::YELLOW);
-            }
-        }
-    } else {
-        tripleButtonPressStart = 0;
-        if (settingsModeRequested) {
-            settingsModeRequested = false;
-        }
+// 에지 1개: 안정 상태와 다르고 마지막 변화 후 디바운스 시간이 지났으면 바로 인정 (첫 에지 시각 = 입력 시각)
+// 디바운스 시간 안의 에지(채터링)는 레벨만 기록 → processButton() 에서 시간이 지난 뒤 최종 레벨 확인
+void RemoteButton::onEdge(uint8_t buttonId, bool pressed, int64_t timeUs) {
+    if (buttonId >= BUTTON_COUNT) return;
+    
+    ButtonState& btn = buttons[buttonId];
+    btn.rawPressed = pressed;
+    btn.rawUs = timeUs;
+    inputStats.edges++;
+    
+    if (pressed == btn.isPressed) return;
+    if (timeUs - btn.changeUs < (int64_t)debounceTime * 1000) {
+        inputStats.bounces++;
+        return;
     }
+    setButtonState(buttonId, pressed, timeUs);
 }
 
-void RemoteButton::processButton(uint8_t buttonId) {
+void RemoteButton::processButton(uint8_t buttonId, int64_t nowUs) {
     if (buttonId >= BUTTON_COUNT) return;
     
     ButtonState& btn = buttons[buttonId];
-    bool currentState = readButton(buttonId);
-    unsigned long now = millis();
+    int64_t debounceUs = (int64_t)debounceTime * 1000;
     
-    // 이전 상태 저장
-    btn.wasPressed = btn.isPressed;
+    // 에지 입력: 채터링이 끝난 뒤 레벨이 인정 상태와 다르면 (짧은 튐, 디바운스 중 놓은 버튼 등) 그 에지로 반영
+    if (interruptMode && btn.rawPressed != btn.isPressed && nowUs - btn.changeUs >= debounceUs) {
+        int64_t timeUs = btn.rawUs;
+        if (timeUs < btn.changeUs + debounceUs) timeUs = btn.changeUs + debounceUs;
+        setButtonState(buttonId, btn.rawPressed, timeUs);
+    }
+    
+    // 조합에 쓰이는 중이면 이번 누름의 제스처(롱프레스/반복/클릭) 감춤
+    if (btn.isPressed && combos.isInCombo(buttonId)) {
+        gestures[buttonId].cancel();
+        return;
+    }
     
-    // 디바운싱
-    if (currentState != btn.isPressed) {
-        unsigned long timeSinceChange = btn.isPressed ? 
-            (now - btn.pressTime) : (now - btn.releaseTime);
+    // 클릭 확정 / 롱프레스 / 반복 (누른 시각 기준이라 loop 가 늦어도 한 번씩)
+    ButtonGesture::Gesture gesture = gestures[buttonId].update(nowUs, (repeatMask >> buttonId) & 1, gestureTiming);
+    if (gesture != ButtonGesture::NONE) {
+        addGestureEvent(buttonId, gesture, nowUs);
+    }
+}
+
+void RemoteButton::setButtonState(uint8_t buttonId, bool pressed, int64_t timeUs) {
+    ButtonState& btn = buttons[buttonId];
+    btn.isPressed = pressed;
+    btn.changeUs = timeUs;
+    if (pressed) {
+        pressedMask |= buttonMask(buttonId);
+    } else {
+        pressedMask &= ~buttonMask(buttonId);
+    }
+    
+    ButtonEventInfo event;
+    event.buttonId = buttonId;
+    event.timeUs = timeUs;
+    
+    if (pressed) {
+        // 버튼 눌림
+        btn.pressUs = timeUs;
+        btn.pressTime = (unsigned long)(timeUs / 1000);
         
-        if (timeSinceChange >= debounceTime) {
-            btn.isPressed = currentState;
-            
-            if (btn.isPressed) {
-                // 버튼 눌림
-                btn.pressTime = now;
-                
-                ButtonEventInfo event;
-                event.buttonId = buttonId;
-                event.event = BUTTON_PRESSED;
-                event.duration = 0;
-                addEvent(event);
-                
-                printf("버튼 %d 누림\r\n", buttonId);
-                
-            } else {
-                // 버튼 릴리스
-                btn.releaseTime = now;
-                unsigned long pressDuration = now - btn.pressTime;
-                
-                ButtonEventInfo event;
-                event.buttonId = buttonId;
-                event.duration = pressDuration;
-                
-                // 롱프레스 확인
-                if (pressDuration >= longPressTime) {
-                    event.event = BUTTON_LONG_PRESS;
-                    printf("버튼 %d 롱프레스\r\n", buttonId);
-                } else {
-                    event.event = BUTTON_RELEASED;
-                    printf("버튼 %d 릴리스\r\n", buttonId);
-                }
-                
-                addEvent(event);
-            }
+        uint8_t action = combos.onPress(buttonId, pressedMask, timeUs);
+        if (action != ButtonComboEngine::NO_ACTION) {
+            addComboEvent(action, timeUs);
+        }
+        if (combos.isHeldBack(buttonId)) {
+            printf("버튼 %d 누림 - 조합 완성 (개별 이벤트 감춤)\r\n", buttonId);
+            return;
+        }
+        
+        sendPress(buttonId, timeUs);
+    } else {
+        // 버튼 릴리스 (롱프레스 후에도 릴리스는 항상 보냄 - 차량 쪽 눌림 상태 해제)
+        btn.releaseTime = (unsigned long)(timeUs / 1000);
+        bool heldBack = combos.onRelease(buttonId);
+        forwardPresses();   // 유지 시간 전에 풀린 동시 누름 (이 버튼 자신일 수도 있음)
+        if (heldBack) {
+            return;         // 눌림을 감췄던 버튼
         }
+        
+        event.event = BUTTON_RELEASED;
+        event.duration = (unsigned long)((timeUs - btn.pressUs) / 1000);
+        event.count = 0;
+        addEvent(event);
+        gestures[buttonId].onRelease(timeUs);
+        
+        printf("버튼 %d 릴리스 (%lu ms)\r\n", buttonId, event.duration);
     }
+}
+
+// 눌림 이벤트 + 제스처
+void RemoteButton::sendPress(uint8_t buttonId, int64_t timeUs) {
+    // 눌림은 더블클릭 여부와 상관없이 바로 (차량 전송 지연 없음)
+    ButtonEventInfo event;
+    event.buttonId = buttonId;
+    event.event = BUTTON_PRESSED;
+    event.duration = 0;
+    event.timeUs = timeUs;
+    event.count = 0;
+    addEvent(event);
     
-    // 롱프레스 체크 (버튼이 계속 눌려있는 경우)
-    if (btn.isPressed && btn.wasPressed) {
-        unsigned long pressDuration = now - btn.pressTime;
-        
-        // 롱프레스 시간 도달 시 한번만 이벤트 발생
-        if (pressDuration >= longPressTime && 
-            pressDuration < longPressTime + 100) {
-            
-            ButtonEventInfo event;
-            event.buttonId = buttonId;
-            event.event = BUTTON_LONG_PRESS;
-            event.duration = pressDuration;
-            addEvent(event);
-            
-            printf("버튼 %d 롱프레스 감지\r\n", buttonId);
+    printf("버튼 %d 누림 (처리 지연 %lu us)\r\n", buttonId,
+           (unsigned long)(esp_timer_get_time() - timeUs));
+    
+    // 더블클릭은 두 번째 누름 바로 뒤 (앞 클릭이 아직 확정 전이면 그 CLICK)
+    ButtonGesture::Gesture gesture = gestures[buttonId].onPress(timeUs, gestureTiming);
+    if (gesture != ButtonGesture::NONE) {
+        addGestureEvent(buttonId, gesture, timeUs);
+    }
+}
+
+// 동시 누름이 유지 시간 전에 풀림: 감췄던 누름을 원래 누른 시각으로 늦게 내보냄
+void RemoteButton::forwardPresses() {
+    uint8_t mask = combos.takeForwarded();
+    for (uint8_t i = 0; mask; i++, mask >>= 1) {
+        if (mask & 1) {
+            printf("버튼 %d 조합 취소 - 감췄던 누름 전달\r\n", i);
+            sendPress(i, buttons[i].pressUs);
         }
     }
 }
@@ -252,9 +439,8 @@ void RemoteButton::setHandlers(RemoteLCD* lcd, RemoteESPNow* espNow, RemoteCANCo
 
 // 이벤트 자동 처리
 void RemoteButton::processEvents() {
-    while (hasEvent()) {
-        ButtonEventInfo event = getEvent();
-        
+    ButtonEventInfo event;
+    while (eventQueue.pop(event)) {
         switch (event.event) {
             case BUTTON_PRESSED:
                 handleButtonPressed(event.buttonId);
@@ -268,6 +454,18 @@ void RemoteButton::processEvents() {
                 handleButtonLongPress(event.buttonId);
                 break;
                 
+            case BUTTON_DOUBLE_CLICK:
+                handleButtonDoubleClick(event.buttonId);
+                break;
+                
+            case BUTTON_REPEAT:
+                handleButtonRepeat(event.buttonId, event.count);
+                break;
+                
+            case BUTTON_COMBO:
+                handleCombo(event.buttonId);
+                break;
+                
             default:
                 break;
         }
@@ -298,11 +496,71 @@ void RemoteButton::handleButtonReleased(uint8_t buttonId) {
 void RemoteButton::handleButtonLongPress(uint8_t buttonId) {
     printf("버튼 %d 롱프레스 - 특수 기능 실행\r\n", buttonId);
     
+    if (pLcd && buttonId == BTN_DOWN) {
+        // DOWN 롱프레스: 진단 콘솔 ↔ 메인 화면
+        if (pLcd->isConsoleShown()) {
+            pLcd->drawMainScreen();
+        } else {
+            pLcd->showConsole();
+        }
+        return;
+    }
+    
     if (pLcd) {
-        // 롱프레스 특수 기능 (예: 설정 메뉴 등)
-        pLcd->setTextSize(1);
-        pLcd->printTextCentered("롱프레스!", 170, RemoteLCD::MAGENTA);
-        delay(500);
-        pLcd->drawMainScreen();
+        // 롱프레스 특수 기능 (예: 설정 메뉴 등), 0.5초 후 update() 가 머리 줄 복원
+        pLcd->showToast("롱프레스!", RemoteLCD::MAGENTA, 500);
+    }
+}
+
+// 버튼 더블클릭 처리 (한 번 클릭의 눌림/릴리스는 이미 차량으로 보냄)
+void RemoteButton::handleButtonDoubleClick(uint8_t buttonId) {
+    if (pLcd) {
+        // 더블클릭 특수 기능 자리, 0.5초 후 update() 가 머리 줄 복원
+        pLcd->showToast("더블클릭!", RemoteLCD::CYAN, 500);
+    }
+}
+
+// 버튼 반복 처리: 차량에는 릴리스 + 눌림 한 쌍 = 한 번 더 누름 (설정 값 한 칸씩, 간격이 점점 빨라짐)
+void RemoteButton::handleButtonRepeat(uint8_t buttonId, uint16_t count) {
+    if (pEspNow) {
+        pEspNow->sendButtonRelease(buttonId);
+        pEspNow->sendButtonPress(buttonId);
+    }
+    if (count == 1 || count % 10 == 0) {
+        printf("버튼 %d 반복 %u회\r\n", buttonId, count);
+    }
+}
+
+// 조합 동작
+void RemoteButton::handleCombo(uint8_t action) {
+    switch (action) {
+        case COMBO_SETTINGS_MODE:
+            printf("=== 설정 모드 콤보 감지 ===\r\n");
+            
+            if (pCanCom) {
+                pCanCom->enterSettingsMode();
+            }
+            
+            if (pLcd) {
+                pLcd->clear();
+                pLcd->drawString("설정 모드", RemoteLCD::SCREEN_WIDTH / 2, 10, { RemoteLCD::CYAN, 1.5, lcdtext::ALIGN_CENTER });
+                pLcd->drawString("CAN 연결 중...", RemoteLCD::SCREEN_WIDTH / 2, 40, { RemoteLCD::YELLOW, 1, lcdtext::ALIGN_CENTER });
+            }
+            break;
+            
+        case COMBO_PRINT_STATS:
+            printf("=== 통계 콤보 ===\r\n");
+            printf("버튼 입력: 에지 %lu, 채터링 %lu, 에지 버림 %lu, 지연 최근 %lu us / 최악 %lu us, 이벤트 버림 %lu (최대 깊이 %lu), 조합 %lu\r\n",
+                   (unsigned long)inputStats.edges, (unsigned long)inputStats.bounces,
+                   (unsigned long)inputStats.dropped, (unsigned long)inputStats.lastLatencyUs,
+                   (unsigned long)inputStats.worstLatencyUs, (unsigned long)inputStats.eventsDropped,
+                   (unsigned long)inputStats.eventHighWater, (unsigned long)combos.getMatches());
+            if (pLcd) {
+                pLcd->printFrameBufferStats();
+            }
+            break;
+            
+        default:
+            break;
     }
 }
@@ -2,6 +2,19 @@
 #define REMOTE_BUTTON_H
 
 #include <Arduino.h>
+#include <soc/soc.h>
+#include <soc/gpio_reg.h>
+#include "SpscQueue.h"
+#include "VerticalCounter.h"
+#include "ButtonCombo.h"
+#include "ButtonGesture.h"
+
+// 버튼 입력 방식 (platformio.ini build_flags 의 -DBUTTON_INPUT_ISR=0 이면 loop() 폴링)
+//   1: GPIO 변화 인터럽트가 에지마다 시각(esp_timer_get_time)을 잠금 없는 큐에 기록 → loop() 가 늦어도 실제 입력 시각 유지
+//   0: scan() 때 GPIO 입력 레지스터 1회 읽기 → 5개 버튼 비트마스크, 세로 카운터로 한꺼번에 디바운스
+#ifndef BUTTON_INPUT_ISR
+#define BUTTON_INPUT_ISR 1
+#endif
 
 // Forward declarations
 class RemoteLCD;
@@ -15,6 +28,19 @@ struct ButtonState {
     bool wasPressed;
     unsigned long pressTime;
     unsigned long releaseTime;
+    
+    // 에지 시각 기반 디바운스 (us)
+    bool rawPressed;        // 마지막 에지의 레벨
+    int64_t rawUs;          // 마지막 에지 시각
+    int64_t changeUs;       // 마지막으로 인정한 상태 변화 시각
+    int64_t pressUs;
+};
+
+// 인터럽트 → loop() 에지 기록
+struct ButtonEdge {
+    int64_t timeUs;         // esp_timer_get_time()
+    uint8_t buttonId;
+    bool pressed;
 };
 
 // 버튼 이벤트 타입
@@ -23,7 +49,10 @@ enum ButtonEvent {
     BUTTON_PRESSED,
     BUTTON_RELEASED,
     BUTTON_LONG_PRESS,
-    BUTTON_DOUBLE_CLICK
+    BUTTON_DOUBLE_CLICK,    // 두 번째 누름 즉시
+    BUTTON_CLICK,           // 더블클릭 시간이 지나 확정된 한 번 클릭 (눌림/릴리스는 이미 보냄)
+    BUTTON_REPEAT,          // 누르고 있는 동안 반복 (count = 반복 횟수, 간격 가속)
+    BUTTON_COMBO            // buttonId = 조합 동작 ID (RemoteButton::ComboAction)
 };
 
 // 버튼 이벤트 정보
@@ -31,6 +60,8 @@ struct ButtonEventInfo {
     uint8_t buttonId;
     ButtonEvent event;
     unsigned long duration;
+    int64_t timeUs;         // 실제 입력 시각 (에지 시각, esp_timer_get_time 기준)
+    uint16_t count;         // BUTTON_REPEAT: 반복 횟수
 };
 
 class RemoteButton {
@@ -62,9 +93,26 @@ public:
     void setDebounceTime(unsigned long ms);
     void setLongPressTime(unsigned long ms);
     void setDoubleClickTime(unsigned long ms);
+    void setRepeatTime(uint16_t delayMs, uint16_t intervalMs, uint16_t minIntervalMs);
     
-    // 버튼 조합 확인
+    // 버튼 조합 확인 (디바운스된 상태 비트마스크 비교, bit i = 버튼 i)
     bool areButtonsPressed(uint8_t btn1, uint8_t btn2, uint8_t btn3);
+    static uint8_t buttonMask(uint8_t buttonId) { return (uint8_t)(1 << buttonId); }
+    uint8_t getPressedMask() const { return pressedMask; }
+    bool isComboPressed(uint8_t mask) const { return (pressedMask & mask) == mask; }
+    
+    // 입력 통계
+    struct InputStats {
+        uint32_t edges;             // 처리한 에지 수
+        uint32_t bounces;           // 디바운스로 무시한 에지 수
+        uint32_t dropped;           // 에지 큐가 가득 차 잃은 에지 수 (다음 scan 에서 핀 다시 읽어 복구)
+        uint32_t eventsDropped;     // 이벤트 큐가 가득 차 버린 이벤트 수
+        uint32_t eventHighWater;    // 이벤트 큐 최대 깊이
+        uint32_t lastLatencyUs;     // 에지 → scan() 처리까지
+        uint32_t worstLatencyUs;
+    };
+    const InputStats& getInputStats() const { return inputStats; }
+    bool isInterruptMode() const { return interruptMode; }
     
     // 버튼 ID 정의 (5버튼)
     static const uint8_t BTN_SELECT = 0;  // IOI_0 (중앙)
@@ -74,16 +122,28 @@ public:
     static const uint8_t BTN_UP = 4;      // IOI_4
     static const uint8_t BUTTON_COUNT = 5;
     
+    // 설정 모드에서 누르고 있으면 반복하는 버튼 (값 빠르게 넘기기, 롱프레스 대신)
+    static const uint8_t REPEAT_BUTTONS = (1 << BTN_DOWN) | (1 << BTN_RIGHT) | (1 << BTN_LEFT) | (1 << BTN_UP);
+    
+    // 조합 동작 ID (조합 표는 RemoteButton.cpp)
+    enum ComboAction : uint8_t {
+        COMBO_NONE = 0,
+        COMBO_SETTINGS_MODE,    // SELECT + LEFT + RIGHT 1초: 설정 모드 진입
+        COMBO_PRINT_STATS       // UP, UP, DOWN: 입력/화면 통계 출력
+    };
+    
 private:
     ButtonState buttons[BUTTON_COUNT];
-    ButtonEventInfo eventQueue[20];
-    uint8_t eventQueueHead;
-    uint8_t eventQueueTail;
+    ButtonGesture gestures[BUTTON_COUNT];
+    // scan() → processEvents() (생산자/소비자가 다른 태스크여도 안전)
+    SpscQueue<ButtonEventInfo, 32> eventQueue;
     
     // 타이밍 설정
     unsigned long debounceTime;
     unsigned long longPressTime;
     unsigned long doubleClickTime;
+    ButtonGesture::Timing gestureTiming;
+    uint8_t repeatMask;     // 이번 scan 의 반복 대상 버튼
     
     // 12512WS-08 직접 GPIO 연결
     static const uint8_t PIN_BTN_SELECT = 12;  // IOI_0
@@ -91,29 +151,57 @@ private:
     static const uint8_t PIN_BTN_RIGHT = 14;   // IOI_2
     static const uint8_t PIN_BTN_LEFT = 27;    // IOI_3
     static const uint8_t PIN_BTN_UP = 26;      // IOI_4
-    
-    uint8_t lastButtonState;
+    static const uint8_t BUTTON_PINS[BUTTON_COUNT];    // 버튼 ID 순서
+    
+    // 디바운스된 눌림 상태 (bit i = 버튼 i)
+    uint8_t pressedMask;
+    
+    // 포트 읽기 + 세로 카운터 (연속 같은 표본 4개, 표본 간격 = 디바운스 시간 / 4)
+    VerticalCounter debouncer;
+    int64_t lastSampleUs;
+    
+    // 인터럽트 입력
+    struct EdgeSource {
+        RemoteButton* owner;
+        uint8_t buttonId;
+        uint8_t pin;
+    };
+    EdgeSource edgeSources[BUTTON_COUNT];   // 핀별 인터럽트 인자
+    SpscQueue<ButtonEdge, 32> edgeQueue;    // 생산자 = GPIO ISR (모든 핀이 ISR 하나를 공유)
+    bool interruptMode;
+    uint32_t edgeDroppedSeen;
+    InputStats inputStats;
     
     // 핸들러 객체 포인터
     RemoteLCD* pLcd;
     RemoteESPNow* pEspNow;
     RemoteCANCom* pCanCom;
     
-    // 설정 모드 진입용
-    unsigned long tripleButtonPressStart;
-    bool settingsModeRequested;
+    // 조합 (동시 누름 / 순서)
+    ButtonComboEngine combos;
     
     // 내부 함수
     void addEvent(ButtonEventInfo event);
-    bool readButton(uint8_t buttonId);
-    void processButton(uint8_t buttonId);
-    uint8_t getPinForButton(uint8_t buttonId);
+    static uint8_t readButtonMask();
+    void scanPort(int64_t nowUs);
+    void processButton(uint8_t buttonId, int64_t nowUs);
+    void pollButtons(int64_t nowUs);
+    void drainEdges(int64_t nowUs);
+    void onEdge(uint8_t buttonId, bool pressed, int64_t timeUs);
+    void setButtonState(uint8_t buttonId, bool pressed, int64_t timeUs);
+    void sendPress(uint8_t buttonId, int64_t timeUs);
+    void forwardPresses();
+    static void onEdgeIsr(void* arg);
     
     // 이벤트 핸들러
     void handleButtonPressed(uint8_t buttonId);
     void handleButtonReleased(uint8_t buttonId);
     void handleButtonLongPress(uint8_t buttonId);
-    void checkSettingsModeCombo();
+    void handleButtonDoubleClick(uint8_t buttonId);
+    void handleButtonRepeat(uint8_t buttonId, uint16_t count);
+    void addGestureEvent(uint8_t buttonId, ButtonGesture::Gesture gesture, int64_t timeUs);
+    void addComboEvent(uint8_t action, int64_t timeUs);
+    void handleCombo(uint8_t action);
 };
 
 #endif // REMOTE_BUTTON_H
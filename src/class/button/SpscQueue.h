@@ -0,0 +1,70 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+// 잠금 없는 단일 생산자/단일 소비자 링 (헤더 전용, Arduino 의존 없음, 호스트 빌드 가능)
+// - 생산자 1곳(ISR 또는 태스크)만 push, 소비자 1곳만 pop. 양쪽 모두 대기/임계구역 없음
+// - 첨자는 계속 증가하는 32비트 값, 칸 = 첨자 & (N - 1) → N 은 2의 거듭제곱
+// - 칸을 채운 뒤 tail 을 release 로 올리고 소비자는 tail 을 acquire 로 읽음 (반대 방향은 head)
+// - 가득 차면 버리고 dropped 증가 (생산자만 씀), highWater = 관측된 최대 깊이
+template <typename T, uint16_t N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue 크기는 2의 거듭제곱");
+    
+public:
+    SpscQueue() : head(0), tail(0), dropped(0), highWater(0) {}
+    
+    // 생산자
+    bool push(const T& item) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+        if (t - h >= N) {
+            dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        
+        slots[t & MASK] = item;
+        tail.store(t + 1, std::memory_order_release);
+        
+        uint32_t depth = t + 1 - h;
+        if (depth > highWater.load(std::memory_order_relaxed)) {
+            highWater.store(depth, std::memory_order_relaxed);
+        }
+        return true;
+    }
+    
+    // 소비자
+    bool pop(T& item) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+        
+        item = slots[h & MASK];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+    
+    // 어느 쪽에서든 (다른 쪽이 동시에 움직이면 근사값)
+    bool isEmpty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+    uint32_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+    static uint16_t capacity() { return N; }
+    
+    uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+    uint32_t getHighWater() const { return highWater.load(std::memory_order_relaxed); }
+    
+private:
+    static const uint32_t MASK = N - 1;
+    
+    T slots[N];
+    std::atomic<uint32_t> head;         // 소비자가 다음에 읽을 첨자
+    std::atomic<uint32_t> tail;         // 생산자가 다음에 쓸 첨자
+    std::atomic<uint32_t> dropped;      // 가득 차서 버린 수
+    std::atomic<uint32_t> highWater;    // 최대 깊이
+};
+
+#endif // SPSC_QUEUE_H
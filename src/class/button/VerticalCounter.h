@@ -0,0 +1,29 @@
+#ifndef VERTICAL_COUNTER_H
+#define VERTICAL_COUNTER_H
+
+#include <stdint.h>
+
+// 세로 카운터 디바운스 (헤더 전용, Arduino 의존 없음, 호스트 빌드 가능)
+// 비트마다 2비트 카운터를 비트 평면 2개(low/high)로 두고 8개 입력을 한꺼번에 셈
+// - 안정 상태와 다른 표본이 SAMPLES 번 연속이면 그 비트 반전
+// - 안정 상태와 같은 표본이 오면 그 비트 카운터만 초기화
+class VerticalCounter {
+public:
+    static const uint8_t SAMPLES = 4;
+
+    VerticalCounter() : low(0xFF), high(0xFF) {}    // 카운터 초기값 3 (변화 없음)
+
+    // 표본 1개 (stable = 지금 인정된 상태), 반환: 반전할 비트
+    uint8_t update(uint8_t sample, uint8_t stable) {
+        uint8_t changed = sample ^ stable;
+        low = ~(low & changed);
+        high = low ^ (high & changed);
+        return changed & low & high;    // 카운터가 한 바퀴 돈 비트
+    }
+
+private:
+    uint8_t low;
+    uint8_t high;
+};
+
+#endif // VERTICAL_COUNTER_H
@@ -120,10 +120,8 @@ bool RemoteCANCom::enterSettingsMode() {
     
     if (success && pLcd) {
         pLcd->clear();
-        pLcd->setTextSize(2);
-        pLcd->printTextCentered("설정 모드", 10, RemoteLCD::CYAN);
-        pLcd->setTextSize(1);
-        pLcd->printTextCentered("Config 읽는 중...", 40, RemoteLCD::YELLOW);
+        pLcd->drawString("설정 모드", RemoteLCD::SCREEN_WIDTH / 2, 10, { RemoteLCD::CYAN, 1.5, lcdtext::ALIGN_CENTER });
+        pLcd->drawString("Config 읽는 중...", RemoteLCD::SCREEN_WIDTH / 2, 40, { RemoteLCD::YELLOW, 1, lcdtext::ALIGN_CENTER });
     }
     
     return success;
@@ -136,8 +134,7 @@ bool RemoteCANCom::exitSettingsMode() {
     bufferIndex = 0;
     
     if (pLcd) {
-        pLcd->clear();
-        pLcd->drawMainScreen();
+        pLcd->drawMainScreen();     // 페이지 전환이 화면 전체를 덮음
     }
     
     return true;
@@ -238,7 +235,7 @@ bool RemoteCANCom::parseConfigData(uint32_t canId, const uint8_t* data, uint8_t
         }
         
         if (pLcd) {
-            pLcd->printTextCentered("Config 로드 완료!", 60, RemoteLCD::GREEN);
+            pLcd->drawString("Config 로드 완료!", RemoteLCD::SCREEN_WIDTH / 2, 60, { RemoteLCD::GREEN, 1, lcdtext::ALIGN_CENTER });
         }
         
         return true;
@@ -303,8 +300,7 @@ void RemoteCANCom::handleConfigDataMessage(uint32_t canId, const twai_message_t&
         
         // LCD에 진행 상황 표시
         if (pLcd) {
-            pLcd->setTextSize(1);
-            pLcd->printTextCentered("64 바이트 수신 완료", 80, RemoteLCD::GREEN);
+            pLcd->drawString("64 바이트 수신 완료", RemoteLCD::SCREEN_WIDTH / 2, 80, { RemoteLCD::GREEN, 1, lcdtext::ALIGN_CENTER });
         }
     }
 }
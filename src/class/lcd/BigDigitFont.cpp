@@ -0,0 +1,50 @@
+#include "BigDigitFont.h"
+
+namespace BigDigitFont {
+
+// 5x7 숫자 원본 (Adafruit 기본 폰트와 같은 모양, 열 단위, LSB = 맨 윗줄)
+static const uint8_t SOURCE_WIDTH = 5;
+static const uint8_t SOURCE_HEIGHT = 7;
+static constexpr uint8_t SOURCE[10][SOURCE_WIDTH] = {
+    { 0x3E, 0x51, 0x49, 0x45, 0x3E },  // 0
+    { 0x00, 0x42, 0x7F, 0x40, 0x00 },  // 1
+    { 0x72, 0x49, 0x49, 0x49, 0x46 },  // 2
+    { 0x21, 0x41, 0x49, 0x4D, 0x33 },  // 3
+    { 0x18, 0x14, 0x12, 0x7F, 0x10 },  // 4
+    { 0x27, 0x45, 0x45, 0x45, 0x39 },  // 5
+    { 0x3C, 0x4A, 0x49, 0x49, 0x31 },  // 6
+    { 0x41, 0x21, 0x11, 0x09, 0x07 },  // 7
+    { 0x36, 0x49, 0x49, 0x49, 0x36 },  // 8
+    { 0x46, 0x49, 0x49, 0x29, 0x1E }   // 9
+};
+
+// 칸 안 위치 (가운데: 좌우/상하 여백 2픽셀)
+static const uint8_t OFFSET_X = (CELL_WIDTH - SOURCE_WIDTH * SCALE) / 2;
+static const uint8_t OFFSET_Y = (CELL_HEIGHT - SOURCE_HEIGHT * SCALE) / 2;
+
+// 열 단위 원본 → 줄 단위 4배 비트맵
+struct DigitTable {
+    uint8_t bits[10][GLYPH_BYTES];
+    
+    constexpr DigitTable() : bits() {
+        for (int d = 0; d < 10; d++) {
+            for (int y = 0; y < SOURCE_HEIGHT * SCALE; y++) {
+                for (int x = 0; x < SOURCE_WIDTH * SCALE; x++) {
+                    if (!(SOURCE[d][x / SCALE] & (1 << (y / SCALE)))) continue;
+                    int px = OFFSET_X + x;
+                    int py = OFFSET_Y + y;
+                    bits[d][py * STRIDE + (px >> 3)] |= 0x80 >> (px & 7);
+                }
+            }
+        }
+    }
+};
+
+// 960바이트, 빌드 시 생성 (플래시)
+static constexpr DigitTable TABLE;
+
+const uint8_t* glyph(uint8_t digit) {
+    return digit < 10 ? TABLE.bits[digit] : nullptr;
+}
+
+}
@@ -0,0 +1,22 @@
+#ifndef BIG_DIGIT_FONT_H
+#define BIG_DIGIT_FONT_H
+
+#include <stdint.h>
+
+// 속도 표시용 큰 숫자 0~9 (Arduino 의존 없음, 호스트 빌드 가능)
+// - 5x7 숫자를 4배로 미리 확대한 1bpp 비트맵 (MSB = 왼쪽 픽셀, 빌드 시 생성)
+// - 글자 칸 전체(간격 포함)가 비트맵이라 배경까지 주소창 1회로 덮어씀 (지우기 불필요)
+namespace BigDigitFont {
+
+static const uint8_t SCALE       = 4;
+static const uint8_t CELL_WIDTH  = 24;     // 6열 x 4
+static const uint8_t CELL_HEIGHT = 32;     // 8줄 x 4
+static const uint8_t STRIDE      = CELL_WIDTH / 8;
+static const uint8_t GLYPH_BYTES = STRIDE * CELL_HEIGHT;
+
+// digit: 0~9 (범위 밖이면 nullptr)
+const uint8_t* glyph(uint8_t digit);
+
+}
+
+#endif // BIG_DIGIT_FONT_H
@@ -0,0 +1,157 @@
+#include "DiagConsole.h"
+#include <stdarg.h>
+#include <string.h>
+
+DiagConsole::DiagConsole() : head(0) {
+    for (uint8_t i = 0; i < LINES; i++) {
+        lines[i].seq.store(0, std::memory_order_relaxed);
+        lines[i].text[0] = '\0';
+    }
+    dropped = 0;
+#ifdef ESP32
+    writeLock = portMUX_INITIALIZER_UNLOCKED;
+#else
+    writeLock.clear();
+#endif
+    original = nullptr;
+    partialLen = 0;
+}
+
+void DiagConsole::append(const char* text, size_t len) {
+    size_t start = 0;
+    for (size_t i = 0; i <= len; i++) {
+        if (i < len && text[i] != '\n') continue;
+        
+        size_t end = i;
+        if (end > start && text[end - 1] == '\r') end--;
+        if (end > start) appendLine(text + start, end - start);
+        start = i + 1;
+    }
+}
+
+void DiagConsole::print(const char* format, ...) {
+    char buf[LINE_BYTES * 2];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    
+    if (len < 0) return;
+    if (len >= (int)sizeof(buf)) len = sizeof(buf) - 1;
+    append(buf, len);
+}
+
+void DiagConsole::lockWriters() {
+#ifdef ESP32
+    portENTER_CRITICAL(&writeLock);
+#else
+    while (writeLock.test_and_set(std::memory_order_acquire)) {}
+#endif
+}
+
+void DiagConsole::unlockWriters() {
+#ifdef ESP32
+    portEXIT_CRITICAL(&writeLock);
+#else
+    writeLock.clear(std::memory_order_release);
+#endif
+}
+
+// 끝의 덜 끝난 UTF-8 글자 제거 (잘린 printf 줄, vsnprintf 버퍼 끝)
+size_t DiagConsole::trimUtf8(const char* text, size_t len) {
+    // 끝에서 이어지는 바이트(10xxxxxx)를 건너 그 글자의 시작 바이트 찾기
+    size_t start = len;
+    while (start > 0 && len - start < 3 && ((uint8_t)text[start - 1] & 0xC0) == 0x80) start--;
+    if (start == 0) return len;
+    start--;
+    
+    uint8_t lead = (uint8_t)text[start];
+    size_t need = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+    return len - start < need ? start : len;
+}
+
+// 잠금 안에서 줄 번호 받기 → 칸 비움 표시 → 복사 → 번호 기록 (읽는 쪽은 앞뒤 번호로 찢어진 복사 검출)
+void DiagConsole::appendLine(const char* text, size_t len) {
+    // UTF-8 글자 중간에서 자르지 않음
+    if (len > LINE_BYTES - 1) len = LINE_BYTES - 1;
+    len = trimUtf8(text, len);
+    
+    lockWriters();
+    uint32_t n = head.load(std::memory_order_relaxed) + 1;
+    Line& line = lines[n % LINES];
+    
+    line.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(line.text, text, len);
+    line.text[len] = '\0';
+    line.seq.store(n, std::memory_order_release);
+    head.store(n, std::memory_order_release);
+    unlockWriters();
+}
+
+bool DiagConsole::read(uint32_t& next, char* out) {
+    uint32_t last = head.load(std::memory_order_acquire);
+    if (next == 0) next = 1;
+    if (next > last) return false;
+    
+    // 링 한 바퀴 이상 밀림: 남아 있는 가장 오래된 줄부터
+    if (last - next >= LINES) {
+        uint32_t oldest = last - LINES + 1;
+        dropped += oldest - next;
+        next = oldest;
+    }
+    
+    Line& line = lines[next % LINES];
+    if (line.seq.load(std::memory_order_acquire) != next) return false;   // 쓰는 중
+    
+    memcpy(out, line.text, LINE_BYTES);
+    out[LINE_BYTES - 1] = '\0';
+    
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (line.seq.load(std::memory_order_relaxed) != next) {
+        // 복사하는 동안 덮어씀: 다음 호출에서 건너뜀
+        return false;
+    }
+    
+    next++;
+    return true;
+}
+
+bool DiagConsole::teeStdout() {
+    if (original) return true;
+    
+    cookie_io_functions_t io = { nullptr, teeWrite, nullptr, nullptr };
+    FILE* tee = fopencookie(this, "w", io);
+    if (!tee) {
+        return false;
+    }
+    setvbuf(tee, nullptr, _IOLBF, LINE_BYTES * 2);
+    
+    original = stdout;
+    stdout = tee;
+#ifdef _GLOBAL_REENT
+    // newlib: 이후 생성되는 태스크(WiFi/ESP-NOW 등)도 같은 stdout 사용
+    _GLOBAL_REENT->_stdout = tee;
+#endif
+    return true;
+}
+
+// 원래 stdout 으로 그대로 보내고, 줄 단위로 모아 콘솔에 추가
+ssize_t DiagConsole::teeWrite(void* cookie, const char* buf, size_t size) {
+    DiagConsole* self = (DiagConsole*)cookie;
+    
+    fwrite(buf, 1, size, self->original);
+    fflush(self->original);
+    
+    for (size_t i = 0; i < size; i++) {
+        char c = buf[i];
+        if (c == '\n') {
+            self->append(self->partial, self->partialLen);
+            self->partialLen = 0;
+        } else if (self->partialLen < LINE_BYTES - 1) {
+            // 넘친 바이트는 버림 (중간에서 끊긴 글자는 appendLine 이 잘라냄)
+            self->partial[self->partialLen++] = c;
+        }
+    }
+    return size;
+}
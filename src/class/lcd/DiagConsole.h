@@ -0,0 +1,70 @@
+#ifndef DIAG_CONSOLE_H
+#define DIAG_CONSOLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <atomic>
+
+#ifdef ESP32
+#include <freertos/FreeRTOS.h>
+#endif
+
+// 진단 콘솔 줄 링 버퍼
+// - 쓰기: 아무 태스크에서나 (ISR 제외). 줄 번호 받기 + 칸 복사를 짧은 임계구역으로 묶어
+//   쓰는 쪽끼리는 한 번에 하나 (같은 칸을 두 태스크가 동시에 쓰지 않음)
+// - 읽기 쪽은 잠금 없음: 칸의 줄 번호를 복사 앞뒤로 확인해 찢어진 줄 검출
+// - 읽기: UI 한 곳에서만 (RemoteLCD 콘솔 화면). 따라잡혀 덮어쓴 줄은 건너뛰고 집계
+// - teeStdout(): printf 출력을 원래 stdout(UART) 과 콘솔에 같이 보냄
+class DiagConsole {
+public:
+    static const uint8_t LINES = 32;        // 링 크기
+    static const uint8_t LINE_BYTES = 64;   // UTF-8, 끝 0 포함 (넘치면 글자 경계에서 자름)
+    
+    DiagConsole();
+    
+    // 텍스트 추가: 줄바꿈으로 나누고 '\r' 과 빈 줄은 버림
+    void append(const char* text, size_t len);
+    void print(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    
+    // 마지막으로 받은 줄 번호 (1부터, 0 = 없음)
+    uint32_t getHead() const { return head.load(std::memory_order_acquire); }
+    
+    // 줄 번호 next 를 out(LINE_BYTES) 으로 복사하고 next 증가
+    // 아직 없거나 쓰는 중이면 false. 링보다 뒤처졌으면 가장 오래된 줄로 건너뜀
+    bool read(uint32_t& next, char* out);
+    uint32_t getDropped() const { return dropped; }     // 읽기 전에 덮어써져 건너뛴 줄 수
+    
+    // printf 가로채기 (setup() 처음, 태스크 생성 전에 1회)
+    bool teeStdout();
+    
+private:
+    struct Line {
+        std::atomic<uint32_t> seq;  // 기록 완료된 줄 번호 (0 = 비었거나 쓰는 중)
+        char text[LINE_BYTES];
+    };
+    
+    Line lines[LINES];
+    std::atomic<uint32_t> head;
+    uint32_t dropped;               // 읽기 쪽 전용
+    
+#ifdef ESP32
+    portMUX_TYPE writeLock;         // 쓰는 쪽 임계구역 (RemoteLCD widgetLock 과 같은 방식)
+#else
+    std::atomic_flag writeLock;     // 호스트: 스핀락
+#endif
+    
+    // stdout 가로채기 (FILE 잠금 안에서만 호출되므로 partial 은 잠금 불필요)
+    FILE* original;
+    char partial[LINE_BYTES];
+    uint8_t partialLen;
+    
+    void appendLine(const char* text, size_t len);
+    void lockWriters();
+    void unlockWriters();
+    static size_t trimUtf8(const char* text, size_t len);
+    static ssize_t teeWrite(void* cookie, const char* buf, size_t size);
+};
+
+#endif // DIAG_CONSOLE_H
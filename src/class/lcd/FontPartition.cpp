@@ -0,0 +1,169 @@
+#include "FontPartition.h"
+#include <stdio.h>
+
+#ifndef ESP32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FontPartition::FontPartition() {
+    base = nullptr;
+    size = 0;
+    header = nullptr;
+    ranges = nullptr;
+    glyphCount = 0;
+#ifdef ESP32
+    handle = 0;
+#else
+    fd = -1;
+#endif
+}
+
+FontPartition::~FontPartition() {
+    end();
+}
+
+#ifdef ESP32
+
+bool FontPartition::begin(const char* label) {
+    if (base) return isLoaded();
+    
+    const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!part) {
+        printf("폰트 파티션 없음 (%s)\r\n", label);
+        return false;
+    }
+    
+    const void* mapped = nullptr;
+    if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &mapped, &handle) != ESP_OK) {
+        printf("폰트 파티션 매핑 실패\r\n");
+        return false;
+    }
+    
+    base = (const uint8_t*)mapped;
+    size = part->size;
+    
+    if (!attach(base, size)) {
+        printf("폰트 파티션 형식 오류 (tools/build_font_partition.py 로 기록 필요)\r\n");
+        end();
+        return false;
+    }
+    
+    printf("폰트 파티션: 구간 %u, 글리프 %lu\r\n",
+           (unsigned)header->rangeCount, (unsigned long)glyphCount);
+    return true;
+}
+
+void FontPartition::end() {
+    if (base) {
+        spi_flash_munmap(handle);
+    }
+    base = nullptr;
+    size = 0;
+    header = nullptr;
+    ranges = nullptr;
+    glyphCount = 0;
+}
+
+#else
+
+bool FontPartition::begin(const char* path) {
+    if (base) return isLoaded();
+    
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("폰트 파일 없음 (%s)\n", path);
+        return false;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        end();
+        return false;
+    }
+    
+    void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+        end();
+        return false;
+    }
+    
+    base = (const uint8_t*)mapped;
+    size = st.st_size;
+    
+    if (!attach(base, size)) {
+        printf("폰트 파일 형식 오류 (%s)\n", path);
+        end();
+        return false;
+    }
+    return true;
+}
+
+void FontPartition::end() {
+    if (base) {
+        munmap((void*)base, size);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    fd = -1;
+    base = nullptr;
+    size = 0;
+    header = nullptr;
+    ranges = nullptr;
+    glyphCount = 0;
+}
+
+#endif
+
+bool FontPartition::attach(const uint8_t* data, size_t length) {
+    if (length < sizeof(Header)) return false;
+    
+    const Header* h = (const Header*)data;
+    if (h->magic != MAGIC || h->version != VERSION || h->glyphHeight != GLYPH_HEIGHT) return false;
+    if (h->fileSize > length) return false;
+    if (sizeof(Header) + (size_t)h->rangeCount * sizeof(Range) > h->fileSize) return false;
+    
+    const Range* r = (const Range*)(data + sizeof(Header));
+    uint32_t total = 0;
+    
+    for (uint16_t i = 0; i < h->rangeCount; i++) {
+        if (r[i].count == 0 || r[i].stride != (r[i].width + 7) / 8) return false;
+        if (i > 0 && r[i].first < r[i - 1].first + r[i - 1].count) return false;  // 정렬/겹침
+        
+        uint32_t bytes = (uint32_t)r[i].count * r[i].stride * GLYPH_HEIGHT;
+        if (r[i].offset > h->fileSize || bytes > h->fileSize - r[i].offset) return false;
+        total += r[i].count;
+    }
+    
+    header = h;
+    ranges = r;
+    glyphCount = total;
+    return true;
+}
+
+const uint8_t* FontPartition::find(uint32_t code, uint8_t& width, uint8_t& stride) const {
+    if (!header) return nullptr;
+    
+    // first <= code 인 마지막 구간
+    int lo = 0;
+    int hi = (int)header->rangeCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) >> 1;
+        const Range& r = ranges[mid];
+        
+        if (code < r.first) {
+            hi = mid - 1;
+        } else if (code >= r.first + r.count) {
+            lo = mid + 1;
+        } else {
+            width = r.width;
+            stride = r.stride;
+            return base + r.offset + (code - r.first) * r.stride * GLYPH_HEIGHT;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,77 @@
+#ifndef FONT_PARTITION_H
+#define FONT_PARTITION_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ESP32
+#include <esp_partition.h>
+#endif
+
+// 플래시 "font" 데이터 파티션의 16x16 확장 폰트 (tools/build_font_partition.py 로 생성)
+// - ESP32: esp_partition_mmap 으로 매핑해 복사 없이 글리프 포인터 반환
+// - 호스트: 같은 파일을 POSIX mmap 으로 읽음
+//
+// 파일 형식 (리틀엔디언):
+//   Header (16바이트)
+//   Range[rangeCount] (12바이트, 코드포인트 오름차순) - 연속된 코드포인트 구간
+//   비트맵 (줄 단위, MSB = 왼쪽, 16줄)
+// 조회: 구간 이진 탐색 → 구간 안에서는 (code - first) 로 바로 인덱싱
+class FontPartition {
+public:
+    static const uint32_t MAGIC = 0x544E464C;  // "LFNT"
+    static const uint16_t VERSION = 1;
+    static const uint8_t GLYPH_HEIGHT = 16;
+    
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t rangeCount;
+        uint16_t glyphHeight;
+        uint16_t reserved;
+        uint32_t fileSize;
+    };
+    
+    struct Range {
+        uint32_t first;     // 첫 코드포인트
+        uint16_t count;     // 글리프 수
+        uint8_t width;      // 픽셀 폭 (8 또는 16)
+        uint8_t stride;     // 줄당 바이트
+        uint32_t offset;    // 파일 시작 기준 비트맵 위치
+    };
+    
+    FontPartition();
+    ~FontPartition();
+    
+#ifdef ESP32
+    bool begin(const char* label = "font");     // 파티션 매핑
+#else
+    bool begin(const char* path);               // 파일 매핑
+#endif
+    void end();
+    
+    bool isLoaded() const { return header != nullptr; }
+    uint16_t getRangeCount() const { return header ? header->rangeCount : 0; }
+    uint32_t getGlyphCount() const { return glyphCount; }
+    
+    // 코드포인트 → 비트맵 (매핑된 메모리 직접), 없으면 nullptr
+    const uint8_t* find(uint32_t code, uint8_t& width, uint8_t& stride) const;
+    
+private:
+    const uint8_t* base;
+    size_t size;
+    const Header* header;
+    const Range* ranges;
+    uint32_t glyphCount;
+    
+#ifdef ESP32
+    spi_flash_mmap_handle_t handle;
+#else
+    int fd;
+#endif
+    
+    // 헤더와 모든 구간이 매핑 범위 안에 있는지 검사 (조회 시 범위 검사 생략)
+    bool attach(const uint8_t* data, size_t length);
+};
+
+#endif // FONT_PARTITION_H
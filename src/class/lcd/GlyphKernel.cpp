@@ -0,0 +1,130 @@
+#include "GlyphKernel.h"
+#include <string.h>
+
+namespace GlyphKernel {
+
+// 바이트 값 → 4워드 마스크 (워드 k = 픽셀 2k(하위 16비트), 2k+1(상위 16비트))
+// 켜진 픽셀 자리는 0xFFFF, 꺼진 자리는 0x0000
+struct MaskTable {
+    uint32_t mask[256][4];
+    
+    constexpr MaskTable() : mask() {
+        for (int v = 0; v < 256; v++) {
+            for (int k = 0; k < 4; k++) {
+                uint32_t lo = (v & (0x80 >> (2 * k))) ? 0x0000FFFFu : 0;
+                uint32_t hi = (v & (0x40 >> (2 * k))) ? 0xFFFF0000u : 0;
+                mask[v][k] = lo | hi;
+            }
+        }
+    }
+};
+
+// 4KB, 빌드 시 생성 (플래시)
+static constexpr MaskTable TABLE;
+
+void expandRow(const uint8_t* src, uint8_t width, uint8_t scale,
+               uint16_t fg, uint16_t bg, uint16_t* out) {
+    uint32_t fg2 = ((uint32_t)fg << 16) | fg;
+    uint32_t bg2 = ((uint32_t)bg << 16) | bg;
+    uint32_t diff = fg2 ^ bg2;
+    uint8_t bytes = width >> 3;
+    uint8_t tail = width & 7;
+    uint16_t* end = out;
+    
+    if (scale == 1) {
+        // 1바이트 → 4워드 (분기 없음)
+        uint32_t* dst = (uint32_t*)out;
+        for (uint8_t b = 0; b < bytes; b++) {
+            const uint32_t* m = TABLE.mask[src[b]];
+            dst[0] = bg2 ^ (diff & m[0]);
+            dst[1] = bg2 ^ (diff & m[1]);
+            dst[2] = bg2 ^ (diff & m[2]);
+            dst[3] = bg2 ^ (diff & m[3]);
+            dst += 4;
+        }
+        end = (uint16_t*)dst;
+    }
+    else if ((scale & 1) == 0) {
+        // 짝수 배율: 픽셀 1개 = 같은 색 워드 scale/2 개 (비트 → 전체 마스크로 색 선택)
+        uint32_t* dst = (uint32_t*)out;
+        uint8_t words = scale >> 1;
+        for (uint8_t b = 0; b < bytes; b++) {
+            uint8_t v = src[b];
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                uint32_t c = bg2 ^ (diff & -(uint32_t)((v >> (7 - bit)) & 1));
+                for (uint8_t w = 0; w < words; w++) *dst++ = c;
+            }
+        }
+        end = (uint16_t*)dst;
+    }
+    else {
+        // 홀수 배율: 16비트 단위 열 복제
+        for (uint8_t b = 0; b < bytes; b++) {
+            uint8_t v = src[b];
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                uint16_t c = (uint16_t)(bg2 ^ (diff & -(uint32_t)((v >> (7 - bit)) & 1)));
+                for (uint8_t s = 0; s < scale; s++) *end++ = c;
+            }
+        }
+    }
+    
+    // 8의 배수가 아닌 폭 (리샘플한 글리프): 남은 비트
+    if (tail) {
+        uint8_t v = src[bytes];
+        for (uint8_t bit = 0; bit < tail; bit++) {
+            uint16_t c = (uint16_t)(bg2 ^ (diff & -(uint32_t)((v >> (7 - bit)) & 1)));
+            for (uint8_t s = 0; s < scale; s++) *end++ = c;
+        }
+    }
+}
+
+void resample(const uint8_t* src, uint8_t srcW, uint8_t srcH, uint8_t srcStride,
+              uint8_t* dst, uint8_t dstW, uint8_t dstH) {
+    uint8_t dstStride = (dstW + 7) >> 3;
+    memset(dst, 0, (size_t)dstStride * dstH);
+    
+    for (uint8_t dy = 0; dy < dstH; dy++) {
+        // 대상 줄이 덮는 원본 줄 구간 [sy0, sy1)
+        uint8_t sy0 = (uint16_t)dy * srcH / dstH;
+        uint8_t sy1 = (uint16_t)(dy + 1) * srcH / dstH;
+        if (sy1 <= sy0) sy1 = sy0 + 1;
+        
+        for (uint8_t dx = 0; dx < dstW; dx++) {
+            uint8_t sx0 = (uint16_t)dx * srcW / dstW;
+            uint8_t sx1 = (uint16_t)(dx + 1) * srcW / dstW;
+            if (sx1 <= sx0) sx1 = sx0 + 1;
+            
+            bool on = false;
+            for (uint8_t sy = sy0; sy < sy1 && !on; sy++) {
+                const uint8_t* row = src + sy * srcStride;
+                for (uint8_t sx = sx0; sx < sx1; sx++) {
+                    if (row[sx >> 3] & (0x80 >> (sx & 7))) {
+                        on = true;
+                        break;
+                    }
+                }
+            }
+            
+            if (on) {
+                dst[dy * dstStride + (dx >> 3)] |= 0x80 >> (dx & 7);
+            }
+        }
+    }
+}
+
+void expandGlyph(const uint8_t* bits, uint8_t width, uint8_t stride, uint8_t scale,
+                 uint16_t fg, uint16_t bg, uint16_t* out) {
+    uint16_t lineWidth = (uint16_t)width * scale;
+    
+    for (uint8_t row = 0; row < 16; row++) {
+        expandRow(bits + row * stride, width, scale, fg, bg, out);
+        
+        // 세로 배율: 확장한 줄 복사
+        for (uint8_t t = 1; t < scale; t++) {
+            memcpy(out + t * lineWidth, out, lineWidth * sizeof(uint16_t));
+        }
+        out += (uint32_t)lineWidth * scale;
+    }
+}
+
+}
@@ -0,0 +1,29 @@
+#ifndef GLYPH_KERNEL_H
+#define GLYPH_KERNEL_H
+
+#include <stdint.h>
+
+// 1bpp → RGB565 글리프 확장 커널 (Arduino 의존 없음, 호스트 빌드 가능)
+// - 폰트 1바이트(MSB = 왼쪽 픽셀)를 256개 마스크 표로 8픽셀 변환
+// - 2픽셀씩 32비트 워드로 저장하므로 출력 버퍼는 4바이트 정렬 필요
+// - 정수 배율: 가로는 열 복제, 세로는 호출 측에서 같은 줄 반복
+namespace GlyphKernel {
+
+// 한 줄 확장: src 의 width 비트 → out 에 width * scale 픽셀
+// (width 가 8의 배수가 아니면 남은 비트는 16비트 단위로 처리)
+void expandRow(const uint8_t* src, uint8_t width, uint8_t scale,
+               uint16_t fg, uint16_t bg, uint16_t* out);
+
+// 전체 글리프 확장: 16줄 x 세로 scale 배 (out 크기 = width*scale * 16*scale)
+void expandGlyph(const uint8_t* bits, uint8_t width, uint8_t stride, uint8_t scale,
+                 uint16_t fg, uint16_t bg, uint16_t* out);
+
+// 글리프 리샘플 (srcW x srcH → dstW x dstH, 대상 줄 간격 = (dstW+7)/8 바이트)
+// 축소는 원본 구간에 켜진 픽셀이 하나라도 있으면 켜서 가는 획을 유지, 확대는 최근접
+// 배율 글리프를 캐시에 만들 때 1회만 호출 (그리기 루프에서는 배율 연산 없음)
+void resample(const uint8_t* src, uint8_t srcW, uint8_t srcH, uint8_t srcStride,
+              uint8_t* dst, uint8_t dstW, uint8_t dstH);
+
+}
+
+#endif // GLYPH_KERNEL_H
@@ -0,0 +1,44 @@
+#include "HangulGlyphCache.h"
+
+HangulGlyphCache::HangulGlyphCache(uint8_t capacity) {
+    bitmaps = nullptr;
+    
+    setCapacity(capacity);
+}
+
+HangulGlyphCache::~HangulGlyphCache() {
+    release();
+}
+
+void HangulGlyphCache::release() {
+    slots.release();
+    delete[] bitmaps;
+    bitmaps = nullptr;
+}
+
+bool HangulGlyphCache::setCapacity(uint8_t newCapacity) {
+    release();
+    
+    if (newCapacity == 0) {
+        return true;  // 캐시 사용 안 함
+    }
+    
+    bitmaps = new uint8_t[newCapacity][GLYPH_BYTES];
+    
+    if (!bitmaps || !slots.allocate(newCapacity)) {
+        release();
+        return false;
+    }
+    
+    return true;
+}
+
+const uint8_t* HangulGlyphCache::find(uint16_t code) {
+    int16_t slot = slots.find(code);
+    return slot == slots.NOT_FOUND ? nullptr : bitmaps[slot];
+}
+
+uint8_t* HangulGlyphCache::insert(uint16_t code) {
+    int16_t slot = slots.claim(code);
+    return slot == slots.NOT_FOUND ? nullptr : bitmaps[slot];
+}
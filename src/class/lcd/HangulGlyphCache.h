@@ -0,0 +1,43 @@
+#ifndef HANGUL_GLYPH_CACHE_H
+#define HANGUL_GLYPH_CACHE_H
+
+#include <stdint.h>
+#include "LruSlots.h"
+
+// 조합 완료된 16x16 한글 글리프 LRU 캐시
+// - 키: 유니코드 코드포인트 (0xAC00 ~ 0xD7A3)
+// - 값: 32바이트 비트맵 (줄 단위 2바이트, MSB=왼쪽)
+// 같은 음절을 반복 출력하는 대시보드에서 초/중/종성 조합을 생략한다.
+class HangulGlyphCache {
+public:
+    static const uint8_t GLYPH_BYTES = 32;
+    static const uint8_t DEFAULT_CAPACITY = 32;
+    
+    HangulGlyphCache(uint8_t capacity = DEFAULT_CAPACITY);
+    ~HangulGlyphCache();
+    
+    // 용량 변경 (기존 항목은 모두 삭제)
+    bool setCapacity(uint8_t capacity);
+    uint8_t getCapacity() const { return slots.getCapacity(); }
+    
+    // 조회: 있으면 비트맵, 없으면 nullptr (히트/미스 집계)
+    const uint8_t* find(uint16_t code);
+    
+    // 삽입: 가장 오래 사용하지 않은 슬롯을 비워 반환 (호출자가 32바이트 채움)
+    uint8_t* insert(uint16_t code);
+    
+    void clear() { slots.clear(); }
+    
+    // 통계
+    uint32_t getHits() const { return slots.getHits(); }
+    uint32_t getMisses() const { return slots.getMisses(); }
+    void resetStats() { slots.resetStats(); }
+
+private:
+    LruSlots<uint16_t> slots;           // 키 = 코드포인트
+    uint8_t (*bitmaps)[GLYPH_BYTES];
+    
+    void release();
+};
+
+#endif // HANGUL_GLYPH_CACHE_H
@@ -0,0 +1,83 @@
+#include "LcdCanvas.h"
+
+// CASET(1+4) + RASET(1+4) + RAMWR(1)
+static const uint8_t ADDR_WINDOW_BYTES = 11;
+
+LcdCanvas::LcdCanvas(int16_t w, int16_t h) : Adafruit_GFX(w, h), dirty(w, h) {
+    writeDepth = 0;
+    batchX0 = batchY0 = batchX1 = batchY1 = 0;
+    resetFlushStats();
+}
+
+void LcdCanvas::resetFlushStats() {
+    flushStats.flushes = 0;
+    flushStats.rects = 0;
+    flushStats.bytes = 0;
+    flushStats.lastUs = 0;
+    flushStats.worstUs = 0;
+}
+
+void LcdCanvas::startWrite(void) {
+    if (writeDepth++ == 0) {
+        batchX0 = batchY0 = 0x7FFF;
+        batchX1 = batchY1 = -1;
+    }
+}
+
+void LcdCanvas::endWrite(void) {
+    if (writeDepth == 0) return;
+    if (--writeDepth == 0 && batchX1 >= batchX0) {
+        dirty.add(batchX0, batchY0, batchX1 - batchX0 + 1, batchY1 - batchY0 + 1);
+    }
+}
+
+void LcdCanvas::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (writeDepth == 0) {
+        dirty.add(x, y, w, h);
+        return;
+    }
+    
+    // 쓰기 묶음 중: 외곽 사각형만 갱신
+    if (x < batchX0) batchX0 = x;
+    if (y < batchY0) batchY0 = y;
+    if (x + w - 1 > batchX1) batchX1 = x + w - 1;
+    if (y + h - 1 > batchY1) batchY1 = y + h - 1;
+}
+
+bool LcdCanvas::clip(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    return w > 0 && h > 0;
+}
+
+void LcdCanvas::flush(Adafruit_ST7789* tft) {
+    if (!tft || dirty.isEmpty()) return;
+    
+    unsigned long start = micros();
+    
+    tft->startWrite();
+    for (uint8_t i = 0; i < dirty.getCount(); i++) {
+        const LcdDirtyRegion::Rect& r = dirty.get(i);
+        
+        tft->setAddrWindow(r.x, r.y, r.w, r.h);
+        for (int16_t row = 0; row < r.h; row++) {
+            const uint16_t* line = getLine565(r.x, r.y + row, r.w, lineBuffer);
+            tft->writePixels((uint16_t*)line, r.w);
+        }
+        
+        flushStats.bytes += ADDR_WINDOW_BYTES + 2UL * r.w * r.h;
+    }
+    tft->endWrite();
+    
+    flushStats.rects += dirty.getCount();
+    dirty.clear();
+    
+    uint32_t elapsed = micros() - start;
+    flushStats.flushes++;
+    flushStats.lastUs = elapsed;
+    if (elapsed > flushStats.worstUs) {
+        flushStats.worstUs = elapsed;
+    }
+}
@@ -0,0 +1,73 @@
+#ifndef LCD_CANVAS_H
+#define LCD_CANVAS_H
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_ST7789.h>
+#include "LcdDirtyRegion.h"
+
+// 메모리 프레임버퍼 공통 부분
+// - Adafruit_GFX 를 상속하므로 도형/클래식 폰트 출력이 그대로 메모리에 그려짐
+// - 그린 영역은 dirty 사각형으로 모았다가 flush() 때 패널로 전송
+class LcdCanvas : public Adafruit_GFX {
+public:
+    LcdCanvas(int16_t w, int16_t h);
+    virtual ~LcdCanvas() {}
+    
+    // 버퍼 할당 (실패 시 false)
+    virtual bool begin() = 0;
+    
+    // 1줄 RGB565 쓰기/읽기 (글리프 블릿, 패널 전송용)
+    // getLine565 는 버퍼를 직접 가리키거나 scratch 에 변환한 결과를 반환
+    virtual void writeLine565(int16_t x, int16_t y, int16_t w, const uint16_t* pixels) = 0;
+    virtual const uint16_t* getLine565(int16_t x, int16_t y, int16_t w, uint16_t* scratch) = 0;
+    
+    // 버퍼 메모리 크기 (바이트)
+    virtual uint32_t getBufferBytes() const = 0;
+    
+    // 변경 영역만 패널로 전송
+    void flush(Adafruit_ST7789* tft);
+    bool isDirty() const { return !dirty.isEmpty(); }
+    
+    // 비동기 전송용: 변경 영역을 넘겨받은 쪽이 전송 후 clearDirty()
+    const LcdDirtyRegion& getDirty() const { return dirty; }
+    void clearDirty() { dirty.clear(); }
+    
+    // Adafruit_GFX 쓰기 묶음: endWrite 때 전체 영역을 한 번에 dirty 등록
+    void startWrite(void) override;
+    void endWrite(void) override;
+    void writePixel(int16_t x, int16_t y, uint16_t color) override { drawPixel(x, y, color); }
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override { fillRect(x, y, w, h, color); }
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { drawFastVLine(x, y, h, color); }
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { drawFastHLine(x, y, w, color); }
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { fillRect(x, y, 1, h, color); }
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { fillRect(x, y, w, 1, color); }
+    void fillScreen(uint16_t color) override { fillRect(0, 0, _width, _height, color); }
+    
+    // 전송 통계
+    struct FlushStats {
+        uint32_t flushes;       // 전송 횟수
+        uint32_t rects;         // 전송한 사각형 수 (누적)
+        uint32_t bytes;         // 전송 바이트 (누적, 명령 포함)
+        uint32_t lastUs;        // 마지막 전송 시간
+        uint32_t worstUs;       // 최악 전송 시간
+    };
+    const FlushStats& getFlushStats() const { return flushStats; }
+    void resetFlushStats();
+    
+protected:
+    LcdDirtyRegion dirty;
+    
+    // 그린 영역 등록 (쓰기 묶음 중이면 합쳐 두었다가 endWrite 때 등록)
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+    
+    // 사각형 클리핑 (보이는 부분이 없으면 false)
+    bool clip(int16_t& x, int16_t& y, int16_t& w, int16_t& h) const;
+    
+private:
+    uint8_t writeDepth;
+    int16_t batchX0, batchY0, batchX1, batchY1;
+    FlushStats flushStats;
+    uint16_t lineBuffer[240];
+};
+
+#endif // LCD_CANVAS_H
@@ -0,0 +1,69 @@
+#include "LcdDirtyRegion.h"
+
+LcdDirtyRegion::LcdDirtyRegion(int16_t width, int16_t height) {
+    this->width = width;
+    this->height = height;
+    count = 0;
+}
+
+void LcdDirtyRegion::add(int16_t x, int16_t y, int16_t w, int16_t h) {
+    // 화면 영역으로 클리핑
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > width) w = width - x;
+    if (y + h > height) h = height - y;
+    if (w <= 0 || h <= 0) return;
+    
+    Rect r = { x, y, w, h };
+    
+    // 겹치거나 맞닿은 사각형 병합 (병합 결과가 다른 사각형과 또 닿을 수 있으므로 반복)
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (uint8_t i = 0; i < count; i++) {
+            if (touches(rects[i], r)) {
+                r = unite(rects[i], r);
+                remove(i);
+                merged = true;
+                break;
+            }
+        }
+    }
+    
+    if (count < MAX_RECTS) {
+        rects[count++] = r;
+        return;
+    }
+    
+    // 목록이 가득 참: 면적 증가가 가장 작은 사각형과 병합
+    uint8_t best = 0;
+    int32_t bestGrowth = 0x7FFFFFFF;
+    for (uint8_t i = 0; i < count; i++) {
+        int32_t growth = area(unite(rects[i], r)) - area(rects[i]);
+        if (growth < bestGrowth) {
+            bestGrowth = growth;
+            best = i;
+        }
+    }
+    r = unite(rects[best], r);
+    remove(best);
+    add(r.x, r.y, r.w, r.h);
+}
+
+bool LcdDirtyRegion::touches(const Rect& a, const Rect& b) {
+    return a.x <= b.x + b.w && b.x <= a.x + a.w &&
+           a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+LcdDirtyRegion::Rect LcdDirtyRegion::unite(const Rect& a, const Rect& b) {
+    int16_t x0 = a.x < b.x ? a.x : b.x;
+    int16_t y0 = a.y < b.y ? a.y : b.y;
+    int16_t x1 = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+    int16_t y1 = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+    Rect r = { x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0) };
+    return r;
+}
+
+void LcdDirtyRegion::remove(uint8_t index) {
+    rects[index] = rects[--count];
+}
@@ -0,0 +1,41 @@
+#ifndef LCD_DIRTY_REGION_H
+#define LCD_DIRTY_REGION_H
+
+#include <stdint.h>
+
+// 변경 영역(dirty rectangle) 목록
+// 겹치거나 맞닿은 사각형은 합치고, 목록이 가득 차면
+// 합쳤을 때 면적 증가가 가장 작은 사각형과 병합한다.
+class LcdDirtyRegion {
+public:
+    struct Rect {
+        int16_t x;
+        int16_t y;
+        int16_t w;
+        int16_t h;
+    };
+    
+    static const uint8_t MAX_RECTS = 16;
+    
+    LcdDirtyRegion(int16_t width, int16_t height);
+    
+    void add(int16_t x, int16_t y, int16_t w, int16_t h);
+    void clear() { count = 0; }
+    
+    bool isEmpty() const { return count == 0; }
+    uint8_t getCount() const { return count; }
+    const Rect& get(uint8_t index) const { return rects[index]; }
+    
+private:
+    int16_t width;
+    int16_t height;
+    Rect rects[MAX_RECTS];
+    uint8_t count;
+    
+    static bool touches(const Rect& a, const Rect& b);
+    static Rect unite(const Rect& a, const Rect& b);
+    static int32_t area(const Rect& r) { return (int32_t)r.w * r.h; }
+    void remove(uint8_t index);
+};
+
+#endif // LCD_DIRTY_REGION_H
@@ -0,0 +1,302 @@
+#include "LcdDmaFlusher.h"
+#include <SPI.h>
+#include <driver/gpio.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+// ST7789 명령
+static const uint8_t ST_CASET = 0x2A;
+static const uint8_t ST_RASET = 0x2B;
+static const uint8_t ST_RAMWR = 0x2C;
+
+static const int SPI_CLOCK_HZ = 40000000;
+static const uint32_t TASK_STACK = 3072;
+static const UBaseType_t TASK_PRIORITY = 2;
+static const BaseType_t TASK_CORE = 0;      // loop()는 코어 1
+
+// pre_cb 는 ISR 에서 호출되므로 DC 핀은 정적 변수로 보관 (디스플레이 1개)
+static gpio_num_t dcPin = GPIO_NUM_4;
+
+LcdDmaFlusher::LcdDmaFlusher() {
+    canvas = nullptr;
+    device = nullptr;
+    queue = nullptr;
+    task = nullptr;
+    dmaBuffer[0] = dmaBuffer[1] = nullptr;
+    memset(dmaTrans, 0, sizeof(dmaTrans));
+    resetStats();
+}
+
+LcdDmaFlusher::~LcdDmaFlusher() {
+    if (task) {
+        vTaskDelete(task);
+        task = nullptr;
+    }
+    release();
+}
+
+void LcdDmaFlusher::resetStats() {
+    stats.jobs = 0;
+    stats.deferred = 0;
+    stats.bytes = 0;
+    stats.busyUs = 0;
+    stats.lastJobUs = 0;
+    stats.worstJobUs = 0;
+    stats.queueHighWater = 0;
+}
+
+bool LcdDmaFlusher::begin(LcdCanvas* target, uint8_t sclk, uint8_t mosi, uint8_t cs, uint8_t dc) {
+    if (task) return true;
+    if (!target) return false;
+    
+    canvas = target;
+    dcPin = (gpio_num_t)dc;
+    
+    // DMA 버퍼는 내부 RAM 이어야 함
+    size_t bufferBytes = (size_t)canvas->width() * LINES_PER_CHUNK * sizeof(uint16_t);
+    dmaBuffer[0] = (uint16_t*)heap_caps_malloc(bufferBytes, MALLOC_CAP_DMA);
+    dmaBuffer[1] = (uint16_t*)heap_caps_malloc(bufferBytes, MALLOC_CAP_DMA);
+    queue = xQueueCreate(QUEUE_LENGTH, sizeof(Job));
+    
+    if (!dmaBuffer[0] || !dmaBuffer[1] || !queue) {
+        printf("LCD DMA: 메모리 할당 실패\r\n");
+        release();
+        return false;
+    }
+    
+    // Adafruit 가 쓰던 SPI 버스를 해제하고 DMA 로 다시 초기화
+    SPI.end();
+    
+    spi_bus_config_t bus;
+    memset(&bus, 0, sizeof(bus));
+    bus.mosi_io_num = mosi;
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = sclk;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = bufferBytes;
+    
+    spi_device_interface_config_t dev;
+    memset(&dev, 0, sizeof(dev));
+    dev.mode = 0;
+    dev.clock_speed_hz = SPI_CLOCK_HZ;
+    dev.spics_io_num = cs;
+    dev.queue_size = 2;
+    dev.pre_cb = preTransfer;
+    
+    if (spi_bus_initialize(VSPI_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+        printf("LCD DMA: SPI 버스 초기화 실패\r\n");
+        SPI.begin(sclk, -1, mosi, cs);
+        release();
+        return false;
+    }
+    
+    if (spi_bus_add_device(VSPI_HOST, &dev, &device) != ESP_OK) {
+        printf("LCD DMA: SPI 장치 등록 실패\r\n");
+        spi_bus_free(VSPI_HOST);
+        SPI.begin(sclk, -1, mosi, cs);
+        release();
+        return false;
+    }
+    
+    if (xTaskCreatePinnedToCore(taskEntry, "lcd_dma", TASK_STACK, this,
+                                TASK_PRIORITY, &task, TASK_CORE) != pdPASS) {
+        printf("LCD DMA: 태스크 생성 실패\r\n");
+        task = nullptr;
+        spi_bus_remove_device(device);
+        device = nullptr;
+        spi_bus_free(VSPI_HOST);
+        SPI.begin(sclk, -1, mosi, cs);
+        release();
+        return false;
+    }
+    
+    printf("LCD DMA 전송 태스크 시작 (코어 %d, 버퍼 2 x %u 바이트)\r\n",
+           (int)TASK_CORE, (unsigned)bufferBytes);
+    return true;
+}
+
+void LcdDmaFlusher::release() {
+    if (dmaBuffer[0]) heap_caps_free(dmaBuffer[0]);
+    if (dmaBuffer[1]) heap_caps_free(dmaBuffer[1]);
+    dmaBuffer[0] = dmaBuffer[1] = nullptr;
+    
+    if (queue) {
+        vQueueDelete(queue);
+        queue = nullptr;
+    }
+}
+
+bool LcdDmaFlusher::submit() {
+    if (!task || !canvas->isDirty()) return true;
+    
+    const LcdDirtyRegion& dirty = canvas->getDirty();
+    
+    // 일부만 넣으면 나머지를 따로 기억해야 하므로 전부 들어갈 때만 넣음
+    if (uxQueueSpacesAvailable(queue) < dirty.getCount()) {
+        stats.deferred++;
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < dirty.getCount(); i++) {
+        const LcdDirtyRegion::Rect& r = dirty.get(i);
+        Job job;
+        job.type = JOB_RECT;
+        job.len = 0;
+        job.x = r.x;
+        job.y = r.y;
+        job.w = r.w;
+        job.h = r.h;
+        queueJob(job);
+    }
+    canvas->clearDirty();
+    return true;
+}
+
+bool LcdDmaFlusher::sendCommand(uint8_t cmd, const uint8_t* data, uint8_t len) {
+    if (!task || len > MAX_COMMAND_DATA) return false;
+    
+    Job job;
+    job.type = JOB_COMMAND;
+    job.cmd = cmd;
+    job.len = len;
+    if (len) {
+        memcpy(job.data, data, len);
+    }
+    
+    if (!queueJob(job)) {
+        stats.deferred++;
+        return false;
+    }
+    return true;
+}
+
+bool LcdDmaFlusher::queueJob(const Job& job) {
+    if (xQueueSend(queue, &job, 0) != pdTRUE) {
+        return false;
+    }
+    
+    uint8_t depth = uxQueueMessagesWaiting(queue);
+    if (depth > stats.queueHighWater) {
+        stats.queueHighWater = depth;
+    }
+    return true;
+}
+
+uint8_t LcdDmaFlusher::getQueueDepth() const {
+    return queue ? uxQueueMessagesWaiting(queue) : 0;
+}
+
+void LcdDmaFlusher::taskEntry(void* arg) {
+    static_cast<LcdDmaFlusher*>(arg)->run();
+}
+
+// 트랜잭션 시작 직전 DC 핀 설정 (user = 0: 명령, 1: 데이터)
+void IRAM_ATTR LcdDmaFlusher::preTransfer(spi_transaction_t* t) {
+    gpio_set_level(dcPin, (uint32_t)(uintptr_t)t->user);
+}
+
+void LcdDmaFlusher::run() {
+    Job job;
+    
+    for (;;) {
+        if (xQueueReceive(queue, &job, portMAX_DELAY) != pdTRUE) continue;
+        
+        int64_t start = esp_timer_get_time();
+        
+        if (job.type == JOB_RECT) {
+            writeRect(job);
+        } else {
+            writeCommand(job.cmd, job.data, job.len);
+        }
+        
+        uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+        stats.jobs++;
+        stats.busyUs += elapsed;
+        stats.lastJobUs = elapsed;
+        if (elapsed > stats.worstJobUs) {
+            stats.worstJobUs = elapsed;
+        }
+    }
+}
+
+// 짧은 명령/데이터는 폴링 전송 (DMA 큐가 비어 있을 때만 호출)
+void LcdDmaFlusher::writeCommand(uint8_t cmd, const uint8_t* data, uint8_t len) {
+    spi_transaction_t t;
+    memset(&t, 0, sizeof(t));
+    t.flags = SPI_TRANS_USE_TXDATA;
+    t.length = 8;
+    t.tx_data[0] = cmd;
+    t.user = (void*)0;
+    spi_device_polling_transmit(device, &t);
+    
+    if (len) {
+        memset(&t, 0, sizeof(t));
+        t.length = len * 8;
+        t.user = (void*)1;
+        if (len <= 4) {
+            t.flags = SPI_TRANS_USE_TXDATA;
+            memcpy(t.tx_data, data, len);
+        } else {
+            t.tx_buffer = data;     // 태스크 스택(내부 RAM)
+        }
+        spi_device_polling_transmit(device, &t);
+    }
+    
+    stats.bytes += 1 + len;
+}
+
+void LcdDmaFlusher::writeRect(const Job& job) {
+    uint16_t x1 = job.x + job.w - 1;
+    uint16_t y1 = job.y + job.h - 1;
+    uint8_t col[4] = { (uint8_t)(job.x >> 8), (uint8_t)job.x, (uint8_t)(x1 >> 8), (uint8_t)x1 };
+    uint8_t row[4] = { (uint8_t)(job.y >> 8), (uint8_t)job.y, (uint8_t)(y1 >> 8), (uint8_t)y1 };
+    
+    writeCommand(ST_CASET, col, 4);
+    writeCommand(ST_RASET, row, 4);
+    writeCommand(ST_RAMWR, nullptr, 0);
+    
+    uint8_t current = 0;
+    uint8_t pending = 0;
+    
+    for (int16_t line = 0; line < job.h; line += LINES_PER_CHUNK) {
+        int16_t lines = job.h - line;
+        if (lines > LINES_PER_CHUNK) lines = LINES_PER_CHUNK;
+        
+        // 두 버퍼 모두 전송 중이면 먼저 보낸 쪽(= 이번에 채울 버퍼)이 끝나길 기다림
+        if (pending == 2) {
+            spi_transaction_t* done;
+            spi_device_get_trans_result(device, &done, portMAX_DELAY);
+            pending--;
+        }
+        
+        // 프레임버퍼 → DMA 버퍼 (패널은 빅엔디언)
+        uint16_t* dst = dmaBuffer[current];
+        for (int16_t i = 0; i < lines; i++) {
+            uint16_t* out = dst + i * job.w;
+            const uint16_t* src = canvas->getLine565(job.x, job.y + line + i, job.w, out);
+            for (int16_t p = 0; p < job.w; p++) {
+                uint16_t c = src[p];
+                out[p] = (c >> 8) | (c << 8);
+            }
+        }
+        
+        spi_transaction_t& t = dmaTrans[current];
+        memset(&t, 0, sizeof(t));
+        t.length = (size_t)lines * job.w * 16;
+        t.tx_buffer = dst;
+        t.user = (void*)1;
+        spi_device_queue_trans(device, &t, portMAX_DELAY);
+        pending++;
+        
+        current ^= 1;
+    }
+    
+    while (pending) {
+        spi_transaction_t* done;
+        spi_device_get_trans_result(device, &done, portMAX_DELAY);
+        pending--;
+    }
+    
+    stats.bytes += 2UL * job.w * job.h;
+}
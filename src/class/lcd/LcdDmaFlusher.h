@@ -0,0 +1,84 @@
+#ifndef LCD_DMA_FLUSHER_H
+#define LCD_DMA_FLUSHER_H
+
+#include <Arduino.h>
+#include <driver/spi_master.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include "LcdCanvas.h"
+
+// 디스플레이 전송 태스크 (SPI DMA)
+// - loop()는 변경 영역을 작업 큐에 넣고 바로 리턴
+// - 전용 태스크(코어 0)가 프레임버퍼 줄을 DMA 버퍼 2개에 번갈아 채우며 전송
+//   (한 버퍼가 전송되는 동안 다음 버퍼를 채움)
+// - Adafruit_ST7789 로 패널 초기화가 끝난 뒤 SPI 버스를 넘겨받으므로
+//   begin() 이후에는 tft 로 직접 그리면 안 됨
+class LcdDmaFlusher {
+public:
+    static const uint8_t QUEUE_LENGTH = 24;         // 작업 큐 길이 (dirty 사각형 16개 + 명령)
+    static const uint8_t LINES_PER_CHUNK = 10;      // DMA 버퍼 1개당 줄 수 (240x10x2 = 4.8KB)
+    static const uint8_t MAX_COMMAND_DATA = 8;
+    
+    LcdDmaFlusher();
+    ~LcdDmaFlusher();
+    
+    // 버스 인수 + 태스크 시작 (실패 시 false, Adafruit SPI 복구)
+    bool begin(LcdCanvas* canvas, uint8_t sclk, uint8_t mosi, uint8_t cs, uint8_t dc);
+    bool isActive() const { return task != nullptr; }
+    
+    // 캔버스 변경 영역을 큐에 넣음 (큐 공간이 모자라면 false, dirty 유지 → 다음 프레임에 재시도)
+    bool submit();
+    
+    // 패널 명령 (스크롤 레지스터 등), 사각형 전송과 같은 큐로 순서 보장
+    bool sendCommand(uint8_t cmd, const uint8_t* data, uint8_t len);
+    
+    // 큐에 남은 작업 수
+    uint8_t getQueueDepth() const;
+    
+    struct Stats {
+        uint32_t jobs;          // 처리한 작업 수
+        uint32_t deferred;      // 큐가 차서 다음 프레임으로 미룬 횟수
+        uint32_t bytes;         // 전송 바이트 (명령 포함)
+        uint32_t busyUs;        // DMA 태스크 전송 시간 누적
+        uint32_t lastJobUs;     // 마지막 작업 시간
+        uint32_t worstJobUs;    // 최악 작업 시간
+        uint8_t queueHighWater; // 최대 큐 깊이
+    };
+    // 태스크가 갱신 (32비트 단위 읽기라 잠금 없이 조회)
+    const Stats& getStats() const { return stats; }
+    void resetStats();
+    
+private:
+    enum JobType : uint8_t {
+        JOB_RECT,
+        JOB_COMMAND
+    };
+    
+    struct Job {
+        JobType type;
+        uint8_t cmd;
+        uint8_t len;
+        uint8_t data[MAX_COMMAND_DATA];
+        int16_t x, y, w, h;
+    };
+    
+    LcdCanvas* canvas;
+    spi_device_handle_t device;
+    QueueHandle_t queue;
+    TaskHandle_t task;
+    uint16_t* dmaBuffer[2];
+    spi_transaction_t dmaTrans[2];
+    Stats stats;
+    
+    static void taskEntry(void* arg);
+    static void IRAM_ATTR preTransfer(spi_transaction_t* t);
+    
+    void run();
+    void writeRect(const Job& job);
+    void writeCommand(uint8_t cmd, const uint8_t* data, uint8_t len);
+    bool queueJob(const Job& job);
+    void release();
+};
+
+#endif // LCD_DMA_FLUSHER_H
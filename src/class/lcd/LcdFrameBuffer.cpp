@@ -0,0 +1,58 @@
+#include "LcdFrameBuffer.h"
+#include <esp_heap_caps.h>
+
+LcdFrameBuffer::LcdFrameBuffer(int16_t w, int16_t h) : LcdCanvas(w, h) {
+    buffer = nullptr;
+}
+
+LcdFrameBuffer::~LcdFrameBuffer() {
+    if (buffer) {
+        heap_caps_free(buffer);
+    }
+}
+
+bool LcdFrameBuffer::begin() {
+    if (buffer) return true;
+    
+    // 내부 RAM에는 WiFi와 함께 둘 수 없으므로 PSRAM에만 할당
+    buffer = (uint16_t*)heap_caps_malloc((size_t)WIDTH * HEIGHT * 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buffer) {
+        return false;
+    }
+    
+    memset(buffer, 0, (size_t)WIDTH * HEIGHT * 2);
+    dirty.add(0, 0, WIDTH, HEIGHT);
+    return true;
+}
+
+void LcdFrameBuffer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    
+    buffer[y * WIDTH + x] = color;
+    markDirty(x, y, 1, 1);
+}
+
+void LcdFrameBuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!clip(x, y, w, h)) return;
+    
+    for (int16_t row = 0; row < h; row++) {
+        uint16_t* dst = &buffer[(y + row) * WIDTH + x];
+        for (int16_t col = 0; col < w; col++) {
+            dst[col] = color;
+        }
+    }
+    markDirty(x, y, w, h);
+}
+
+void LcdFrameBuffer::writeLine565(int16_t x, int16_t y, int16_t w, const uint16_t* pixels) {
+    if (y < 0 || y >= _height || x < 0 || x + w > _width) return;
+    
+    memcpy(&buffer[y * WIDTH + x], pixels, w * 2);
+    markDirty(x, y, w, 1);
+}
+
+const uint16_t* LcdFrameBuffer::getLine565(int16_t x, int16_t y, int16_t w, uint16_t* scratch) {
+    (void)w;
+    (void)scratch;
+    return &buffer[y * WIDTH + x];  // 이미 RGB565
+}
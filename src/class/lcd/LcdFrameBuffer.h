@@ -0,0 +1,26 @@
+#ifndef LCD_FRAME_BUFFER_H
+#define LCD_FRAME_BUFFER_H
+
+#include "LcdCanvas.h"
+
+// PSRAM 전체 화면 RGB565 프레임버퍼 (240x320 = 150KB)
+class LcdFrameBuffer : public LcdCanvas {
+public:
+    LcdFrameBuffer(int16_t w, int16_t h);
+    ~LcdFrameBuffer();
+    
+    bool begin() override;
+    
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    
+    void writeLine565(int16_t x, int16_t y, int16_t w, const uint16_t* pixels) override;
+    const uint16_t* getLine565(int16_t x, int16_t y, int16_t w, uint16_t* scratch) override;
+    
+    uint32_t getBufferBytes() const override { return buffer ? (uint32_t)WIDTH * HEIGHT * 2 : 0; }
+    
+private:
+    uint16_t* buffer;
+};
+
+#endif // LCD_FRAME_BUFFER_H
@@ -0,0 +1,146 @@
+#include "LcdIndexedFrameBuffer.h"
+#include <esp_heap_caps.h>
+
+LcdIndexedFrameBuffer::LcdIndexedFrameBuffer(int16_t w, int16_t h) : LcdCanvas(w, h) {
+    buffer = nullptr;
+    paletteUsed = 1;
+    palette[0] = 0x0000;  // 0번 = 검정 (초기화 색)
+    for (uint8_t i = 1; i < PALETTE_SIZE; i++) {
+        palette[i] = 0x0000;
+    }
+    lastColor = 0x0000;
+    lastIndex = 0;
+}
+
+LcdIndexedFrameBuffer::~LcdIndexedFrameBuffer() {
+    if (buffer) {
+        heap_caps_free(buffer);
+    }
+}
+
+bool LcdIndexedFrameBuffer::begin() {
+    if (buffer) return true;
+    
+    buffer = (uint8_t*)heap_caps_malloc((size_t)WIDTH * HEIGHT / 2, MALLOC_CAP_8BIT);
+    if (!buffer) {
+        return false;
+    }
+    
+    memset(buffer, 0, (size_t)WIDTH * HEIGHT / 2);
+    dirty.add(0, 0, WIDTH, HEIGHT);
+    return true;
+}
+
+void LcdIndexedFrameBuffer::setPalette(const uint16_t* colors, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        colorIndex(colors[i]);
+    }
+}
+
+uint8_t LcdIndexedFrameBuffer::colorIndex(uint16_t color) {
+    if (color == lastColor) return lastIndex;
+    
+    uint8_t index = PALETTE_SIZE;
+    for (uint8_t i = 0; i < paletteUsed; i++) {
+        if (palette[i] == color) {
+            index = i;
+            break;
+        }
+    }
+    
+    if (index == PALETTE_SIZE) {
+        if (paletteUsed < PALETTE_SIZE) {
+            index = paletteUsed++;
+            palette[index] = color;
+        } else {
+            index = nearestIndex(color);
+        }
+    }
+    
+    lastColor = color;
+    lastIndex = index;
+    return index;
+}
+
+// RGB565 거리 기준 가장 가까운 팔레트 색
+uint8_t LcdIndexedFrameBuffer::nearestIndex(uint16_t color) const {
+    int r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+    uint8_t best = 0;
+    int32_t bestDist = 0x7FFFFFFF;
+    
+    for (uint8_t i = 0; i < paletteUsed; i++) {
+        int dr = r - (palette[i] >> 11);
+        int dg = g - ((palette[i] >> 5) & 0x3F);
+        int db = b - (palette[i] & 0x1F);
+        int32_t dist = 4 * dr * dr + dg * dg + 4 * db * db;  // 5/6/5비트 스케일 보정
+        if (dist < bestDist) {
+            bestDist = dist;
+            best = i;
+        }
+    }
+    return best;
+}
+
+void LcdIndexedFrameBuffer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+    
+    setIndex(x, y, colorIndex(color));
+    markDirty(x, y, 1, 1);
+}
+
+void LcdIndexedFrameBuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!clip(x, y, w, h)) return;
+    
+    uint8_t index = colorIndex(color);
+    uint8_t pair = (index << 4) | index;
+    
+    for (int16_t row = y; row < y + h; row++) {
+        int16_t col = x;
+        int16_t end = x + w;
+        
+        // 홀수 시작 픽셀
+        if (col & 1) setIndex(col++, row, index);
+        
+        // 가운데 바이트 단위 채우기
+        int16_t bytes = (end - col) >> 1;
+        if (bytes > 0) {
+            memset(&buffer[(row * WIDTH + col) >> 1], pair, bytes);
+            col += bytes * 2;
+        }
+        
+        // 남은 짝수 픽셀
+        if (col < end) setIndex(col, row, index);
+    }
+    markDirty(x, y, w, h);
+}
+
+void LcdIndexedFrameBuffer::writeLine565(int16_t x, int16_t y, int16_t w, const uint16_t* pixels) {
+    if (y < 0 || y >= _height || x < 0 || x + w > _width) return;
+    
+    for (int16_t i = 0; i < w; i++) {
+        setIndex(x + i, y, colorIndex(pixels[i]));
+    }
+    markDirty(x, y, w, 1);
+}
+
+const uint16_t* LcdIndexedFrameBuffer::getLine565(int16_t x, int16_t y, int16_t w, uint16_t* scratch) {
+    const uint8_t* src = &buffer[(y * WIDTH + x) >> 1];
+    int16_t i = 0;
+    
+    // 홀수 시작 픽셀 (하위 니블)
+    if (x & 1) {
+        scratch[i++] = palette[*src++ & 0x0F];
+    }
+    
+    // 바이트당 2픽셀 LUT 변환
+    for (; i + 1 < w; i += 2) {
+        uint8_t pair = *src++;
+        scratch[i] = palette[pair >> 4];
+        scratch[i + 1] = palette[pair & 0x0F];
+    }
+    
+    if (i < w) {
+        scratch[i] = palette[*src >> 4];
+    }
+    return scratch;
+}
@@ -0,0 +1,49 @@
+#ifndef LCD_INDEXED_FRAME_BUFFER_H
+#define LCD_INDEXED_FRAME_BUFFER_H
+
+#include "LcdCanvas.h"
+
+// 4bpp 팔레트 프레임버퍼 (240x320 = 37.5KB, 내부 RAM)
+// PSRAM 없는 보드용. 픽셀은 16색 팔레트 인덱스로 저장하고
+// 전송할 때 16개짜리 LUT로 RGB565 변환한다.
+// 팔레트에 없는 색은 빈 칸에 등록하고, 빈 칸이 없으면 가장 가까운 색을 사용한다.
+class LcdIndexedFrameBuffer : public LcdCanvas {
+public:
+    static const uint8_t PALETTE_SIZE = 16;
+    
+    LcdIndexedFrameBuffer(int16_t w, int16_t h);
+    ~LcdIndexedFrameBuffer();
+    
+    bool begin() override;
+    
+    // 팔레트 미리 등록 (RemoteLCD::Color 등)
+    void setPalette(const uint16_t* colors, uint8_t count);
+    uint8_t getPaletteUsed() const { return paletteUsed; }
+    
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    
+    void writeLine565(int16_t x, int16_t y, int16_t w, const uint16_t* pixels) override;
+    const uint16_t* getLine565(int16_t x, int16_t y, int16_t w, uint16_t* scratch) override;
+    
+    uint32_t getBufferBytes() const override { return buffer ? (uint32_t)WIDTH * HEIGHT / 2 : 0; }
+    
+private:
+    uint8_t* buffer;                    // 2픽셀/바이트 (짝수 x = 상위 니블)
+    uint16_t palette[PALETTE_SIZE];     // 인덱스 → RGB565 LUT
+    uint8_t paletteUsed;
+    
+    // 마지막 변환 캐시 (글리프 줄은 전경/배경 2색 반복)
+    uint16_t lastColor;
+    uint8_t lastIndex;
+    
+    uint8_t colorIndex(uint16_t color);
+    uint8_t nearestIndex(uint16_t color) const;
+    
+    inline void setIndex(int16_t x, int16_t y, uint8_t index) {
+        uint8_t* p = &buffer[(y * WIDTH + x) >> 1];
+        *p = (x & 1) ? ((*p & 0xF0) | index) : ((*p & 0x0F) | (index << 4));
+    }
+};
+
+#endif // LCD_INDEXED_FRAME_BUFFER_H
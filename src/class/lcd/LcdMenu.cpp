@@ -0,0 +1,85 @@
+#include "LcdMenu.h"
+
+LcdMenu::LcdMenu(int16_t top, uint8_t visibleRows, uint8_t rowHeight)
+    : visibleRows(visibleRows > MAX_VISIBLE ? MAX_VISIBLE : (visibleRows ? visibleRows : 1)),
+      rowHeight(rowHeight),
+      scroll(top, this->visibleRows * rowHeight, rowHeight) {
+    items = nullptr;
+    count = 0;
+    selected = 0;
+    first = 0;
+    valid = false;
+    scrolled = false;
+    stats.steps = 0;
+    stats.full = 0;
+    stats.rows = 0;
+    stats.scrolls = 0;
+}
+
+void LcdMenu::setItems(const char* const* items, uint8_t count) {
+    this->items = items;
+    this->count = count;
+    selected = 0;
+    first = 0;
+    valid = false;
+}
+
+// 중복 없이 추가
+uint8_t LcdMenu::addRow(uint8_t* rows, uint8_t n, uint8_t index) {
+    for (uint8_t i = 0; i < n; i++) {
+        if (rows[i] == index) return n;
+    }
+    rows[n] = index;
+    return n + 1;
+}
+
+uint8_t LcdMenu::select(uint8_t index, uint8_t* rows) {
+    scrolled = false;
+    if (count == 0) return 0;
+    if (index >= count) index = count - 1;
+    
+    uint8_t visible = count < visibleRows ? count : visibleRows;
+    uint8_t oldFirst = first;
+    uint8_t oldSelected = selected;
+    
+    // 선택 항목이 보이도록 창 이동 (최소 이동)
+    if (index < first) {
+        first = index;
+    } else if (index >= first + visible) {
+        first = index - visible + 1;
+    }
+    selected = index;
+    scroll.scrollTo(first);
+    
+    uint8_t shift = first > oldFirst ? first - oldFirst : oldFirst - first;
+    uint8_t n = 0;
+    stats.steps++;
+    
+    if (!valid || shift >= visible) {
+        // 처음 또는 창 전체가 바뀜: 보이는 줄 모두
+        for (uint8_t i = 0; i < visible; i++) {
+            rows[n++] = first + i;
+        }
+        scrolled = true;
+        valid = true;
+        stats.full++;
+    } else {
+        // 창이 움직였으면 새로 들어온 줄 (나간 줄의 칸을 재사용)
+        if (first > oldFirst) {
+            for (uint8_t i = oldFirst + visible; i < first + visible; i++) n = addRow(rows, n, i);
+        } else {
+            for (uint8_t i = first; i < oldFirst; i++) n = addRow(rows, n, i);
+        }
+        
+        // 선택 표시가 바뀐 줄
+        if (index != oldSelected) {
+            if (oldSelected >= first && oldSelected < first + visible) n = addRow(rows, n, oldSelected);
+            n = addRow(rows, n, index);
+        }
+        scrolled = shift != 0;
+    }
+    
+    if (scrolled && shift) stats.scrolls++;
+    stats.rows += n;
+    return n;
+}
@@ -0,0 +1,65 @@
+#ifndef LCD_MENU_H
+#define LCD_MENU_H
+
+#include <stdint.h>
+#include "LcdScrollRegion.h"
+
+// 목록 메뉴 (Arduino 의존 없음, 호스트 빌드 가능)
+// 선택 이동 시 다시 그릴 항목만 계산한다: 이전 선택 줄 + 새 선택 줄 (보통 2줄)
+// 항목이 한 화면보다 많으면 하드웨어 세로 스크롤 창으로 넘김 - 새로 들어온 줄만 그리고 시작 주소 이동
+// 그리기/명령 전송은 RemoteLCD::drawMenu() 가 담당
+class LcdMenu {
+public:
+    static const uint8_t MAX_VISIBLE = 12;
+    static const uint8_t MAX_ROWS = MAX_VISIBLE + 2;    // select() 가 돌려주는 최대 줄 수
+    
+    // top: 첫 줄 y, visibleRows: 한 화면 줄 수 (MAX_VISIBLE 이하), rowHeight: 줄 간격
+    LcdMenu(int16_t top, uint8_t visibleRows, uint8_t rowHeight);
+    
+    void setItems(const char* const* items, uint8_t count);
+    
+    // 화면이 지워졌을 때 (다음 select 는 보이는 줄 전체)
+    void invalidate() { valid = false; }
+    bool isValid() const { return valid; }
+    
+    // 선택을 index 로 옮기고 다시 그릴 항목 번호를 rows 에 (MAX_ROWS 칸), 반환: 줄 수
+    uint8_t select(uint8_t index, uint8_t* rows);
+    
+    // 마지막 select 에서 창이 움직였음 (스크롤 주소 전송 필요)
+    bool isScrolled() const { return scrolled; }
+    bool isScrollable() const { return count > visibleRows; }
+    
+    const char* getItem(uint8_t index) const { return index < count ? items[index] : ""; }
+    uint8_t getCount() const { return count; }
+    uint8_t getSelected() const { return selected; }
+    uint8_t getFirst() const { return first; }
+    
+    // 항목이 그려질 패널 메모리 y (스크롤 칸 위치)
+    int16_t rowY(uint8_t index) const { return scroll.slotY(index); }
+    const LcdScrollRegion& getScroll() const { return scroll; }
+    
+    struct Stats {
+        uint32_t steps;     // select 횟수
+        uint32_t full;      // 보이는 줄 전체를 그린 횟수
+        uint32_t rows;      // 다시 그린 줄 합계
+        uint32_t scrolls;   // 창 이동 횟수
+    };
+    const Stats& getStats() const { return stats; }
+    
+    const uint8_t visibleRows;
+    const uint8_t rowHeight;
+    
+private:
+    LcdScrollRegion scroll;     // 칸 = 줄, 칸 수 = visibleRows
+    const char* const* items;
+    uint8_t count;
+    uint8_t selected;
+    uint8_t first;              // 맨 위에 보이는 항목
+    bool valid;
+    bool scrolled;
+    Stats stats;
+    
+    static uint8_t addRow(uint8_t* rows, uint8_t n, uint8_t index);
+};
+
+#endif // LCD_MENU_H
@@ -0,0 +1,73 @@
+#include "LcdPageCache.h"
+#include <esp_heap_caps.h>
+
+LcdPageCache::LcdPageCache() {
+    for (uint8_t i = 0; i < MAX_PAGES; i++) {
+        snapshots[i] = nullptr;
+    }
+    width = 0;
+    height = 0;
+    bytes = 0;
+}
+
+LcdPageCache::~LcdPageCache() {
+    for (uint8_t i = 0; i < MAX_PAGES; i++) {
+        if (snapshots[i]) {
+            heap_caps_free(snapshots[i]);
+        }
+    }
+}
+
+bool LcdPageCache::save(uint8_t page, LcdCanvas* canvas) {
+    if (page >= MAX_PAGES || !canvas) return false;
+    
+    int16_t w = canvas->width();
+    int16_t h = canvas->height();
+    size_t size = (size_t)w * h * 2;
+    
+    if (!snapshots[page]) {
+        // 내부 RAM 은 WiFi 와 프레임버퍼 몫이므로 PSRAM 에만
+        snapshots[page] = (uint16_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (!snapshots[page]) {
+            return false;
+        }
+        bytes += size;
+    }
+    width = w;
+    height = h;
+    
+    uint16_t* dst = snapshots[page];
+    for (int16_t row = 0; row < h; row++) {
+        const uint16_t* line = canvas->getLine565(0, row, w, dst);
+        if (line != dst) {
+            memcpy(dst, line, w * 2);
+        }
+        dst += w;
+    }
+    return true;
+}
+
+bool LcdPageCache::restore(uint8_t page, LcdCanvas* canvas) const {
+    return restoreRect(page, canvas, 0, 0, width, height);
+}
+
+bool LcdPageCache::restoreRect(uint8_t page, LcdCanvas* canvas, int16_t x, int16_t y, int16_t w, int16_t h) const {
+    if (!has(page) || !canvas) return false;
+    
+    // 저장본 범위로 클리핑
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > width) w = width - x;
+    if (y + h > height) h = height - y;
+    if (w <= 0 || h <= 0) return true;
+    
+    // 줄마다 dirty 등록하지 않고 한 번에
+    canvas->startWrite();
+    const uint16_t* src = snapshots[page] + (size_t)y * width + x;
+    for (int16_t row = 0; row < h; row++) {
+        canvas->writeLine565(x, y + row, w, src);
+        src += width;
+    }
+    canvas->endWrite();
+    return true;
+}
@@ -0,0 +1,33 @@
+#ifndef LCD_PAGE_CACHE_H
+#define LCD_PAGE_CACHE_H
+
+#include "LcdCanvas.h"
+
+// 페이지 정적 레이어 저장본 (PSRAM, 페이지당 화면 전체 RGB565 150KB)
+// - 처음 그린 직후 save(), 이후 전환은 restore() 로 줄 단위 복사 (그리기 목록 다시 실행 없음)
+// - PSRAM 이 없거나 부족하면 save() 가 false → 호출자는 그리기 목록을 다시 실행
+// - 저장/복원은 LcdCanvas 줄 인터페이스를 쓰므로 RGB565/4bpp 버퍼 모두 가능
+class LcdPageCache {
+public:
+    static const uint8_t MAX_PAGES = 8;
+    
+    LcdPageCache();
+    ~LcdPageCache();
+    
+    bool save(uint8_t page, LcdCanvas* canvas);
+    bool has(uint8_t page) const { return page < MAX_PAGES && snapshots[page]; }
+    
+    // 화면 전체 / 일부 영역 복원 (저장본 없으면 false)
+    bool restore(uint8_t page, LcdCanvas* canvas) const;
+    bool restoreRect(uint8_t page, LcdCanvas* canvas, int16_t x, int16_t y, int16_t w, int16_t h) const;
+    
+    uint32_t getBytes() const { return bytes; }    // 사용 중인 PSRAM
+    
+private:
+    uint16_t* snapshots[MAX_PAGES];
+    int16_t width;
+    int16_t height;
+    uint32_t bytes;
+};
+
+#endif // LCD_PAGE_CACHE_H
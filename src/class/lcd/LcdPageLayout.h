@@ -0,0 +1,58 @@
+#ifndef LCD_PAGE_LAYOUT_H
+#define LCD_PAGE_LAYOUT_H
+
+#include <stdint.h>
+#include "StaticText.h"
+#include "TextLayout.h"
+
+// 페이지 정적 레이어 그리기 목록 (라벨, 구분선 등 값이 바뀌지 않는 부분)
+// 항목은 constexpr 로 만들어 플래시 상수 표로 둔다. 문자열은 LCD_TEXT 로 미리 디코딩된 것만 사용
+// 예)
+//   static constexpr auto TITLE = LCD_TEXT("설정");
+//   static constexpr LcdPageItem ITEMS[] = { LcdPageItem::centered(TITLE, 5, CYAN), ... };
+//   static constexpr LcdPageLayout LAYOUT = { ITEMS, sizeof(ITEMS) / sizeof(ITEMS[0]) };
+struct LcdPageItem {
+    enum Type : uint8_t {
+        TEXT,           // 상자 안 정렬 글자
+        HLINE,          // 가로선 (w)
+        FILL_CIRCLE     // 채운 원 (h = 반지름)
+    };
+    
+    static const int16_t PAGE_WIDTH = 240;
+    
+    Type type;
+    uint8_t align;      // lcdtext::TextAlign
+    uint16_t scaleQ8;   // 글자 배율 (8.8)
+    int16_t x, y, w, h;
+    uint16_t color;
+    lcdtext::TextView text;
+    
+    // 왼쪽 정렬, 상자 = x 부터 화면 끝까지
+    static constexpr LcdPageItem label(lcdtext::TextView text, int16_t x, int16_t y, uint16_t color,
+                                       lcdtext::TextScale scale = 1) {
+        return { TEXT, lcdtext::ALIGN_LEFT, scale.q8, x, y, (int16_t)(PAGE_WIDTH - x),
+                 (int16_t)scale.apply(16), color, text };
+    }
+    
+    // 화면 폭 가운데 정렬
+    static constexpr LcdPageItem centered(lcdtext::TextView text, int16_t y, uint16_t color,
+                                          lcdtext::TextScale scale = 1) {
+        return { TEXT, lcdtext::ALIGN_CENTER, scale.q8, 0, y, PAGE_WIDTH,
+                 (int16_t)scale.apply(16), color, text };
+    }
+    
+    static constexpr LcdPageItem hline(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        return { HLINE, 0, 0x100, x, y, w, 1, color, lcdtext::TextView{ nullptr, 0, 0 } };
+    }
+    
+    static constexpr LcdPageItem circle(int16_t x, int16_t y, int16_t r, uint16_t color) {
+        return { FILL_CIRCLE, 0, 0x100, x, y, 0, r, color, lcdtext::TextView{ nullptr, 0, 0 } };
+    }
+};
+
+struct LcdPageLayout {
+    const LcdPageItem* items;
+    uint8_t count;
+};
+
+#endif // LCD_PAGE_LAYOUT_H
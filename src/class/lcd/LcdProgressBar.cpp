@@ -0,0 +1,62 @@
+#include "LcdProgressBar.h"
+
+LcdProgressBar::LcdProgressBar(int16_t x, int16_t y, uint16_t w, uint16_t h)
+    : x(x), y(y), w(w), h(h) {
+    borderColor = 0xFFFF;
+    fillColor = 0x07E0;
+    lowColor = 0xF800;
+    bgColor = 0x0000;
+    lowThreshold = 20;
+    
+    valid = false;
+    lastFill = 0;
+    lastColor = 0;
+    stats.full = 0;
+    stats.partial = 0;
+    stats.pixels = 0;
+}
+
+void LcdProgressBar::setColors(uint16_t border, uint16_t fill, uint16_t low, uint16_t background) {
+    borderColor = border;
+    fillColor = fill;
+    lowColor = low;
+    bgColor = background;
+    valid = false;
+}
+
+void LcdProgressBar::draw(Adafruit_GFX* gfx, uint8_t percentage) {
+    if (!gfx) return;
+    if (percentage > 100) percentage = 100;
+    
+    uint16_t inner = w - 2 * INSET;
+    uint16_t fill = ((uint32_t)inner * percentage) / 100;
+    uint16_t color = percentage > lowThreshold ? fillColor : lowColor;
+    
+    if (!valid || color != lastColor) {
+        // 처음 또는 색 경계 통과: 테두리 + 채움 + 빈 부분
+        gfx->drawRect(x, y, w, h, borderColor);
+        fillStrip(gfx, 0, fill, color);
+        fillStrip(gfx, fill, inner, bgColor);
+        stats.full++;
+    }
+    else if (fill > lastFill) {
+        fillStrip(gfx, lastFill, fill, color);      // 늘어난 띠
+        stats.partial++;
+    }
+    else if (fill < lastFill) {
+        fillStrip(gfx, fill, lastFill, bgColor);    // 줄어든 띠
+        stats.partial++;
+    }
+    
+    lastFill = fill;
+    lastColor = color;
+    valid = true;
+}
+
+// 안쪽 [from, to) 열 구간 칠하기
+void LcdProgressBar::fillStrip(Adafruit_GFX* gfx, uint16_t from, uint16_t to, uint16_t color) {
+    if (from >= to) return;
+    uint16_t stripH = h - 2 * INSET;
+    gfx->fillRect(x + INSET + from, y + INSET, to - from, stripH, color);
+    stats.pixels += (uint32_t)(to - from) * stripH;
+}
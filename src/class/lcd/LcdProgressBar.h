@@ -0,0 +1,51 @@
+#ifndef LCD_PROGRESS_BAR_H
+#define LCD_PROGRESS_BAR_H
+
+#include <Adafruit_GFX.h>
+
+// 유지 모드 진행바
+// 마지막 채움 폭과 색을 기억해 값이 바뀌면 늘어난/줄어든 띠만 그린다.
+// 색 경계(lowThreshold)를 넘을 때와 invalidate() 후에만 테두리 포함 전체를 다시 그림
+class LcdProgressBar {
+public:
+    LcdProgressBar(int16_t x, int16_t y, uint16_t w, uint16_t h);
+    
+    void setColors(uint16_t border, uint16_t fill, uint16_t low, uint16_t background);
+    void setLowThreshold(uint8_t percentage) { lowThreshold = percentage; }
+    
+    // 변경분 그리기 (percentage > 100 은 100)
+    void draw(Adafruit_GFX* gfx, uint8_t percentage);
+    
+    // 화면이 지워졌을 때 (다음 draw 는 전체 그리기)
+    void invalidate() { valid = false; }
+    
+    struct Stats {
+        uint32_t full;      // 전체 그리기 횟수
+        uint32_t partial;   // 띠만 그린 횟수
+        uint32_t pixels;    // 칠한 픽셀 수 (테두리 제외)
+    };
+    const Stats& getStats() const { return stats; }
+    
+    const int16_t x;
+    const int16_t y;
+    const uint16_t w;
+    const uint16_t h;
+    
+private:
+    static const uint8_t INSET = 2;     // 테두리 + 여백
+    
+    uint16_t borderColor;
+    uint16_t fillColor;
+    uint16_t lowColor;
+    uint16_t bgColor;
+    uint8_t lowThreshold;   // 이하이면 lowColor
+    
+    bool valid;
+    uint16_t lastFill;      // 채움 폭 (픽셀)
+    uint16_t lastColor;
+    Stats stats;
+    
+    void fillStrip(Adafruit_GFX* gfx, uint16_t from, uint16_t to, uint16_t color);
+};
+
+#endif // LCD_PROGRESS_BAR_H
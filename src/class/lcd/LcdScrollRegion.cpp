@@ -0,0 +1,22 @@
+#include "LcdScrollRegion.h"
+
+LcdScrollRegion::LcdScrollRegion(int16_t top, uint16_t rows, uint16_t step)
+    : top(top), rows(rows), step(step ? step : 1) {
+    head = 0;
+}
+
+int16_t LcdScrollRegion::advance() {
+    int16_t y = top + head * step;
+    head = (head + 1 == getSlots()) ? 0 : head + 1;
+    return y;
+}
+
+void LcdScrollRegion::getDefinitionData(uint16_t screenHeight, uint8_t* data) const {
+    uint16_t bottom = screenHeight - top - rows;
+    data[0] = top >> 8;
+    data[1] = top & 0xFF;
+    data[2] = rows >> 8;
+    data[3] = rows & 0xFF;
+    data[4] = bottom >> 8;
+    data[5] = bottom & 0xFF;
+}
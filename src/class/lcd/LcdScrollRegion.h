@@ -0,0 +1,44 @@
+#ifndef LCD_SCROLL_REGION_H
+#define LCD_SCROLL_REGION_H
+
+#include <stdint.h>
+
+// ST7789 하드웨어 세로 스크롤 영역 (Arduino 의존 없음, 호스트 빌드 가능)
+// - 화면 줄 [top, top + rows) 를 스크롤 영역으로 정의 (VSCRDEF), 위/아래는 고정 영역
+// - 새 칸(step 줄)은 패널 메모리의 다음 칸에 쓰고 시작 주소(VSCSAD)만 옮김
+//   → 최신 칸이 맨 아래, 위로 흘러감. 영역 전체를 다시 그리지 않음
+// 전송은 RemoteLCD 가 담당하고 여기서는 줄 주소와 명령 파라미터만 만든다.
+class LcdScrollRegion {
+public:
+    static const uint8_t CMD_VSCRDEF = 0x33;   // 세로 스크롤 영역 정의
+    static const uint8_t CMD_VSCSAD  = 0x37;   // 세로 스크롤 시작 주소
+    
+    // rows 는 step 의 배수
+    LcdScrollRegion(int16_t top, uint16_t rows, uint16_t step = 1);
+    
+    // 패널 메모리 줄 = 화면 줄 상태로 (getAddress() == top)
+    void reset() { head = 0; }
+    
+    // 다음 칸의 패널 메모리 첫 줄. 그린 뒤 getAddress() 를 보내면 이 칸이 맨 아래에 보임
+    int16_t advance();
+    
+    // 목록 창 방식: 항목 index 는 항상 칸 (index % 칸 수) 에 그림
+    // scrollTo(first) 후 getAddress() 를 보내면 first 가 맨 위 (앞뒤 어느 방향이든 새로 들어온 칸만 그리면 됨)
+    void scrollTo(uint32_t first) { head = first % getSlots(); }
+    int16_t slotY(uint32_t index) const { return top + (index % getSlots()) * step; }
+    
+    uint16_t getAddress() const { return top + head * step; }
+    uint16_t getSlots() const { return rows / step; }
+    
+    // VSCRDEF 파라미터 6바이트 (빅엔디언)
+    void getDefinitionData(uint16_t screenHeight, uint8_t* data) const;
+    
+    const int16_t top;
+    const uint16_t rows;
+    const uint16_t step;
+    
+private:
+    uint16_t head;          // 다음에 쓸 칸 (0 ~ getSlots()-1)
+};
+
+#endif // LCD_SCROLL_REGION_H
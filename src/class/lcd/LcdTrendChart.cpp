@@ -0,0 +1,83 @@
+#include "LcdTrendChart.h"
+
+LcdTrendChart::LcdTrendChart(int16_t top, uint16_t rows, uint16_t width)
+    : width(width > MAX_WIDTH ? MAX_WIDTH : width), scroll(top, rows) {
+    for (uint8_t i = 0; i < MAX_SERIES; i++) {
+        series[i].color = 0xFFFF;
+        series[i].min = 0;
+        series[i].max = 100;
+        series[i].lastX = -1;
+    }
+    seriesCount = 0;
+    bgColor = 0x0000;
+    gridColor = 0x4208;
+    samples = 0;
+}
+
+void LcdTrendChart::setSeries(uint8_t index, uint16_t color, int32_t min, int32_t max) {
+    if (index >= MAX_SERIES || max <= min) return;
+    
+    series[index].color = color;
+    series[index].min = min;
+    series[index].max = max;
+    series[index].lastX = -1;
+    if (index >= seriesCount) seriesCount = index + 1;
+}
+
+void LcdTrendChart::setColors(uint16_t background, uint16_t grid) {
+    bgColor = background;
+    gridColor = grid;
+}
+
+void LcdTrendChart::reset() {
+    scroll.reset();
+    samples = 0;
+    for (uint8_t i = 0; i < MAX_SERIES; i++) {
+        series[i].lastX = -1;
+    }
+}
+
+// 배경 + 25/50/75% 세로 격자
+void LcdTrendChart::renderBlankRow(uint16_t* out) const {
+    for (uint16_t x = 0; x < width; x++) {
+        out[x] = bgColor;
+    }
+    for (uint8_t k = 1; k < 4; k++) {
+        out[(width * k) / 4] = gridColor;
+    }
+}
+
+int16_t LcdTrendChart::renderRow(const Sample& sample, uint16_t* out) {
+    // 격자는 한 줄 건너 점선
+    if (samples & 1) {
+        for (uint16_t x = 0; x < width; x++) out[x] = bgColor;
+    } else {
+        renderBlankRow(out);
+    }
+    
+    for (uint8_t i = 0; i < seriesCount; i++) {
+        Series& s = series[i];
+        int16_t x = toX(s, sample.value[i]);
+        
+        // 이전 점과 가로선으로 연결 (값이 그대로면 2픽셀 점)
+        int16_t x0 = x, x1 = x + 1;
+        if (s.lastX >= 0) {
+            if (s.lastX < x0) x0 = s.lastX;
+            if (s.lastX + 1 > x1) x1 = s.lastX + 1;
+        }
+        if (x1 >= (int16_t)width) x1 = width - 1;
+        for (int16_t px = x0; px <= x1; px++) {
+            out[px] = s.color;
+        }
+        s.lastX = x;
+    }
+    
+    samples++;
+    return scroll.advance();
+}
+
+int16_t LcdTrendChart::toX(const Series& s, int32_t value) const {
+    if (value <= s.min) return 0;
+    if (value >= s.max) return width - 2;
+    return (int16_t)(((int64_t)(value - s.min) * (width - 2)) / (s.max - s.min));
+}
@@ -0,0 +1,65 @@
+#ifndef LCD_TREND_CHART_H
+#define LCD_TREND_CHART_H
+
+#include <stdint.h>
+#include "LcdScrollRegion.h"
+
+// 하드웨어 세로 스크롤 추세 그래프 (Arduino 의존 없음, 호스트 빌드 가능)
+// - 샘플 1개 = 가로 1줄 (값 → x 위치, 계열마다 이전 샘플과 가로선으로 연결)
+// - 줄은 스크롤 영역(LcdScrollRegion)의 다음 메모리 줄에 써서 그래프 전체를 다시 그리지 않음
+// 전송(줄 쓰기, 명령)은 RemoteLCD 가 담당하고 여기서는 줄 픽셀만 만든다.
+class LcdTrendChart {
+public:
+    static const uint8_t MAX_SERIES  = 3;
+    static const uint16_t MAX_WIDTH  = 240;
+    
+    struct Sample {
+        int32_t value[MAX_SERIES];
+        
+        bool operator==(const Sample& other) const {
+            for (uint8_t i = 0; i < MAX_SERIES; i++) {
+                if (value[i] != other.value[i]) return false;
+            }
+            return true;
+        }
+    };
+    
+    LcdTrendChart(int16_t top, uint16_t rows, uint16_t width);
+    
+    // 계열: 색, 값 범위 (min → 왼쪽, max → 오른쪽, 밖이면 끝에 붙음)
+    void setSeries(uint8_t index, uint16_t color, int32_t min, int32_t max);
+    void setColors(uint16_t background, uint16_t grid);
+    
+    // 스크롤 위치 / 이전 점 초기화
+    void reset();
+    
+    // 빈 줄 (배경 + 격자), 그래프를 처음 그릴 때 스크롤 영역 줄 수만큼 사용
+    void renderBlankRow(uint16_t* out) const;
+    
+    // 다음 샘플 1줄 생성 → out (width 픽셀), 반환: 써야 할 패널 메모리 줄
+    // 호출 후 getScroll().getAddress() 를 VSCSAD 로 보내면 이 줄이 맨 아래에 보임
+    int16_t renderRow(const Sample& sample, uint16_t* out);
+    
+    const LcdScrollRegion& getScroll() const { return scroll; }
+    
+    const uint16_t width;
+    
+private:
+    struct Series {
+        uint16_t color;
+        int32_t min;
+        int32_t max;
+        int16_t lastX;      // -1 = 이전 점 없음
+    };
+    
+    LcdScrollRegion scroll;
+    Series series[MAX_SERIES];
+    uint8_t seriesCount;
+    uint16_t bgColor;
+    uint16_t gridColor;
+    uint32_t samples;       // 격자 점선용 누적 수
+    
+    int16_t toX(const Series& s, int32_t value) const;
+};
+
+#endif // LCD_TREND_CHART_H
@@ -0,0 +1,69 @@
+#ifndef LCD_WIDGET_H
+#define LCD_WIDGET_H
+
+#include <stdint.h>
+
+// 유지 모드(retained) 위젯 상태
+// 마지막으로 그린 값과 영역을 기억해 값이 같으면 SPI 작업을 생략한다.
+template <typename T>
+class LcdWidget {
+public:
+    LcdWidget(int16_t x, int16_t y, uint16_t w, uint16_t h)
+        : x(x), y(y), w(w), h(h), last(), valid(false), hasLast(false), pending(), hasPending(false) {}
+    
+    // 화면에 그려진 값과 다르면 true
+    bool isChanged(const T& value) const { return !valid || !(value == last); }
+    
+    // 그린 값 기록
+    void commit(const T& value) {
+        last = value;
+        valid = true;
+        hasLast = true;
+    }
+    
+    // 화면이 지워졌을 때 (다음 값은 무조건 그림)
+    void invalidate() { valid = false; }
+    
+    bool isValid() const { return valid; }
+    bool hasValue() const { return hasLast; }     // 한 번이라도 그렸음 (invalidate 후에도 유지)
+    const T& getValue() const { return last; }
+    
+    // 컴포지터 대기 값 (다음 프레임에 그림, 잠금은 호출자 책임)
+    // 이미 대기 중인 값을 덮어쓰면 true (coalesced)
+    bool post(const T& value) {
+        bool coalesced = hasPending;
+        pending = value;
+        hasPending = true;
+        return coalesced;
+    }
+    
+    // 화면 전환 후 다시 그릴 값 대기 (이미 새 값이 대기 중이면 그 값이 우선, 잠금은 호출자 책임)
+    bool restore(const T& value) {
+        if (hasPending) return false;
+        pending = value;
+        hasPending = true;
+        return true;
+    }
+    
+    bool take(T& value) {
+        if (!hasPending) return false;
+        value = pending;
+        hasPending = false;
+        return true;
+    }
+    
+    // 위젯 영역
+    const int16_t x;
+    const int16_t y;
+    const uint16_t w;
+    const uint16_t h;
+    
+private:
+    T last;
+    bool valid;
+    bool hasLast;
+    T pending;
+    bool hasPending;
+};
+
+#endif // LCD_WIDGET_H
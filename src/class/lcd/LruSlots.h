@@ -0,0 +1,106 @@
+#ifndef LRU_SLOTS_H
+#define LRU_SLOTS_H
+
+#include <stdint.h>
+
+// 고정 용량 LRU 슬롯 관리 (헤더 전용, Arduino 의존 없음, 호스트 빌드 가능)
+// 키/사용 순번/히트·미스만 관리하고, 슬롯 번호에 딸린 값 배열은 사용하는 캐시가 가짐
+// - 키 0 = 빈 슬롯 (0 이 아닌 키만 사용)
+// - 용량이 작아(수십 개) 선형 탐색
+template <typename Key>
+class LruSlots {
+public:
+    static const int16_t NOT_FOUND = -1;
+    
+    LruSlots() : capacity(0), keys(nullptr), lastUsed(nullptr), useCounter(0), hits(0), misses(0) {}
+    ~LruSlots() { release(); }
+    
+    // 슬롯 할당 (기존 항목은 모두 삭제, 0 = 사용 안 함)
+    bool allocate(uint8_t newCapacity) {
+        release();
+        if (newCapacity == 0) return true;
+    
+        keys = new Key[newCapacity];
+        lastUsed = new uint32_t[newCapacity];
+        if (!keys || !lastUsed) {
+            release();
+            return false;
+        }
+    
+        capacity = newCapacity;
+        clear();
+        return true;
+    }
+    
+    void release() {
+        delete[] keys;
+        delete[] lastUsed;
+        keys = nullptr;
+        lastUsed = nullptr;
+        capacity = 0;
+    }
+    
+    uint8_t getCapacity() const { return capacity; }
+    
+    // 조회: 있으면 슬롯 번호 (사용 순번 갱신), 없으면 NOT_FOUND (히트/미스 집계)
+    int16_t find(Key key) {
+        for (uint8_t i = 0; i < capacity; i++) {
+            if (keys[i] == key) {
+                lastUsed[i] = ++useCounter;
+                hits++;
+                return i;
+            }
+        }
+        misses++;
+        return NOT_FOUND;
+    }
+    
+    // 삽입: 빈 슬롯 또는 가장 오래 사용하지 않은 슬롯을 key 로 차지 (용량 0 이면 NOT_FOUND)
+    int16_t claim(Key key) {
+        if (capacity == 0) return NOT_FOUND;
+    
+        uint8_t victim = 0;
+        for (uint8_t i = 0; i < capacity; i++) {
+            if (keys[i] == 0) {
+                victim = i;
+                break;
+            }
+            if (lastUsed[i] < lastUsed[victim]) {
+                victim = i;
+            }
+        }
+    
+        keys[victim] = key;
+        lastUsed[victim] = ++useCounter;
+        return victim;
+    }
+    
+    void clear() {
+        for (uint8_t i = 0; i < capacity; i++) {
+            keys[i] = 0;
+            lastUsed[i] = 0;
+        }
+        useCounter = 0;
+    }
+    
+    // 통계
+    uint32_t getHits() const { return hits; }
+    uint32_t getMisses() const { return misses; }
+    void resetStats() {
+        hits = 0;
+        misses = 0;
+    }
+
+private:
+    uint8_t capacity;
+    Key* keys;
+    uint32_t* lastUsed;                 // LRU 타임스탬프 (사용 순번)
+    uint32_t useCounter;
+    uint32_t hits;
+    uint32_t misses;
+    
+    LruSlots(const LruSlots&);
+    LruSlots& operator=(const LruSlots&);
+};
+
+#endif // LRU_SLOTS_H
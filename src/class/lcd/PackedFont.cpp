@@ -0,0 +1,30 @@
+#include "PackedFont.h"
+#include <string.h>
+#include "font/packed_font.h"
+
+namespace PackedFont {
+
+void decodeEnglish(uint8_t ch, uint8_t* glyph) {
+    const uint8_t* p = PACKED_ENGLISH_DATA + PACKED_ENGLISH_OFFSET[ch & 0x7F];
+    uint32_t mask = p[0] | (p[1] << 8);
+    p += 2;
+    
+    memset(glyph, 0, ENGLISH_BYTES);
+    while (mask) {
+        glyph[__builtin_ctz(mask)] = *p++;
+        mask &= mask - 1;
+    }
+}
+
+void orHangulPart(uint16_t index, uint8_t* glyph) {
+    const uint8_t* p = PACKED_KFONT_DATA + PACKED_KFONT_OFFSET[index];
+    uint32_t mask = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    p += 4;
+    
+    while (mask) {
+        glyph[__builtin_ctz(mask)] |= *p++;
+        mask &= mask - 1;
+    }
+}
+
+}
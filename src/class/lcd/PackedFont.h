@@ -0,0 +1,23 @@
+#ifndef PACKED_FONT_H
+#define PACKED_FONT_H
+
+#include <stdint.h>
+
+// 압축 폰트 디코더 (font/packed_font.h, tools/pack_font.py 로 생성)
+// 글리프 = 0이 아닌 바이트 위치 마스크 + 0이 아닌 바이트들.
+// 출력은 RemoteLCD 글리프 형식 그대로 (줄 단위, MSB = 왼쪽) 이므로 변환이 필요 없다.
+// Arduino 의존 없음 (호스트 빌드 가능)
+namespace PackedFont {
+
+static const uint8_t ENGLISH_BYTES = 16;    // 8x16, 줄당 1바이트
+static const uint8_t HANGUL_BYTES = 32;     // 16x16, 줄당 2바이트
+
+// 영문 1글자 디코딩 (ch < 128)
+void decodeEnglish(uint8_t ch, uint8_t* glyph);
+
+// 한글 자모 1개를 glyph 에 OR (초·중·종성 합성용, glyph 는 호출자가 0으로 초기화)
+void orHangulPart(uint16_t index, uint8_t* glyph);
+
+}
+
+#endif // PACKED_FONT_H
@@ -1,8 +1,54 @@
 #include "RemoteLCD.h"
 
-RemoteLCD::RemoteLCD() {
-    currentTextSize = 1;
+RemoteLCD::RemoteLCD()
+    : speedWidget((SCREEN_WIDTH - SPEED_DIGITS * BigDigitFont::CELL_WIDTH) / 2, 90,
+                  SPEED_DIGITS * BigDigitFont::CELL_WIDTH, BigDigitFont::CELL_HEIGHT),
+      directionWidget(85, 130, 150, 32),
+      motorTempWidget(50, 220, 70, 16),
+      fetTempWidget(165, 220, 70, 16),
+      currentWidget(50, 240, 80, 16),
+      batteryWidget(10, 272, 220, 18),
+      batteryBar(10, 272, 220, 18),
+      trendWidget(0, 166, SCREEN_WIDTH, 50),
+      trendChart(166, 50, SCREEN_WIDTH),
+      consoleScroll(24, 18 * 16, 16),
+      rssiWidget(110, 300, 120, 16),
+      linkWidget(15, 298, 85, 16) {
     tft = nullptr;
+    canvas = nullptr;
+    dma = nullptr;
+    gfx = nullptr;
+    _times = 1;
+    _scaleQ8 = 0x100;
+    setClip(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    memset(speedShown, 0, sizeof(speedShown));
+    consoleNext = 1;
+    activeScroll = nullptr;
+    scrollPending = false;
+    pendingScrollAddress = 0;
+    
+    currentPage = PAGE_NONE;
+    currentLayout = nullptr;
+    pageSwitching = false;
+    pageFromCache = false;
+    pageStartUs = 0;
+    memset(&pageStats, 0, sizeof(pageStats));
+    toastUntil = 0;
+    
+    // 추세 그래프 계열 (범례 = 메인 화면 라벨 색)
+    trendChart.setSeries(0, YELLOW, 0, 120);        // 모터 온도 (°C)
+    trendChart.setSeries(1, MAGENTA, 0, 120);       // FET 온도 (°C)
+    trendChart.setSeries(2, CYAN, 0, 50000);        // 모터 전류 (mA)
+    trendChart.setColors(BLACK, 0x2104);
+    
+    framePeriodUs = 0;
+    lastFrameTime = 0;
+    widgetLock = portMUX_INITIALIZER_UNLOCKED;
+    resetFrameStats();
+    
+    widgetStats.redraws = 0;
+    widgetStats.skipped = 0;
+    resetTextStats();
 }
 
 bool RemoteLCD::begin() {
@@ -19,6 +65,46 @@ bool RemoteLCD::begin() {
     // ST7789 초기화 (240x320 세로형)
     tft->init(SCREEN_WIDTH, SCREEN_HEIGHT);
     tft->setRotation(0); // 세로 모드 (Portrait)
+    gfx = tft;
+    
+#if LCD_FRAMEBUFFER_MODE == LCD_FB_RGB565
+    canvas = new LcdFrameBuffer(SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (canvas && !canvas->begin()) {
+        // PSRAM 없음 - 4bpp 팔레트 모드로 재시도
+        printf("LCD RGB565 프레임버퍼 할당 실패 - 4bpp 팔레트로 전환\r\n");
+        delete canvas;
+        canvas = nullptr;
+    }
+#endif
+#if LCD_FRAMEBUFFER_MODE == LCD_FB_RGB565 || LCD_FRAMEBUFFER_MODE == LCD_FB_INDEXED4
+    // 4bpp 팔레트 (RGB565 는 위에서 이미 할당 시도 - 여기서는 새로 만든 캔버스만 begin)
+    if (!canvas) {
+        canvas = createIndexedCanvas();
+        if (canvas && !canvas->begin()) {
+            printf("LCD 프레임버퍼 할당 실패 - 직접 그리기\r\n");
+            delete canvas;
+            canvas = nullptr;
+        }
+    }
+#endif
+    if (canvas) {
+        gfx = canvas;
+        printf("LCD 프레임버퍼 사용 (%lu 바이트)\r\n", (unsigned long)canvas->getBufferBytes());
+    }
+    
+#if LCD_ASYNC_FLUSH
+    if (canvas) {
+        dma = new LcdDmaFlusher();
+        if (dma && !dma->begin(canvas, TFT_SCLK, TFT_MOSI, TFT_CS, TFT_DC)) {
+            printf("LCD DMA 사용 불가 - 동기 전송\r\n");
+            delete dma;
+            dma = nullptr;
+        }
+    }
+#endif
+    
+    // 확장 폰트 (기호/Latin-1/완성형 한글), 없으면 내장 폰트 + 대체 글리프
+    fontPartition.begin();
     
     clear();
     
@@ -26,52 +112,290 @@ bool RemoteLCD::begin() {
     return true;
 }
 
+void RemoteLCD::printFrameBufferStats() {
+    if (canvas) {
+        const LcdCanvas::FlushStats& fs = canvas->getFlushStats();
+        printf("프레임버퍼: %lu 바이트, 전송 %lu회 %lu 바이트, 최근 %lu us, 최악 %lu us\r\n",
+               (unsigned long)canvas->getBufferBytes(), (unsigned long)fs.flushes,
+               (unsigned long)fs.bytes, (unsigned long)fs.lastUs, (unsigned long)fs.worstUs);
+    } else {
+        // 직접 그리기는 그리는 동안 바로 SPI 전송: 글자 전송량 + 프레임 시간(전송 대기 포함)이 전송 비용
+        printf("프레임버퍼: 없음 (직접 그리기, 0 바이트), 글자 SPI %lu회 %lu 바이트, 프레임 최근 %lu us, 최악 %lu us\r\n",
+               (unsigned long)totalTextStats.transactions, (unsigned long)totalTextStats.bytes,
+               (unsigned long)frameStats.lastFrameUs, (unsigned long)frameStats.worstFrameUs);
+    }
+    
+    if (dma) {
+        const LcdDmaFlusher::Stats& ds = dma->getStats();
+        printf("LCD DMA: 작업 %lu, 큐 %u (최대 %u), 미룸 %lu, 전송 %lu 바이트, 사용 %lu us (최악 %lu us)\r\n",
+               (unsigned long)ds.jobs, (unsigned)dma->getQueueDepth(), (unsigned)ds.queueHighWater,
+               (unsigned long)ds.deferred, (unsigned long)ds.bytes, (unsigned long)ds.busyUs,
+               (unsigned long)ds.worstJobUs);
+    }
+    
+    const LcdProgressBar::Stats& bs = batteryBar.getStats();
+    printf("배터리 진행바: 전체 %lu회, 띠 %lu회, %lu 픽셀\r\n",
+           (unsigned long)bs.full, (unsigned long)bs.partial, (unsigned long)bs.pixels);
+    printf("페이지: 전환 %lu회 (저장본 %lu회), 최근 %lu us, 최악 %lu us, 저장본 %lu 바이트\r\n",
+           (unsigned long)pageStats.switches, (unsigned long)pageStats.cached,
+           (unsigned long)pageStats.lastUs, (unsigned long)pageStats.worstUs,
+           (unsigned long)pageCache.getBytes());
+}
+
+LcdCanvas* RemoteLCD::createIndexedCanvas() {
+    LcdIndexedFrameBuffer* indexed = new LcdIndexedFrameBuffer(SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (!indexed) {
+        return nullptr;
+    }
+    
+    // UI 색상을 팔레트 앞쪽에 고정 (나머지 7칸은 처음 쓰이는 색에 배정)
+    static const uint16_t UI_COLORS[] = {
+        BLACK, WHITE, RED, GREEN, BLUE, YELLOW, CYAN, MAGENTA, GRAY
+    };
+    indexed->setPalette(UI_COLORS, sizeof(UI_COLORS) / sizeof(UI_COLORS[0]));
+    return indexed;
+}
+
 void RemoteLCD::clear() {
     if (tft) {
-        tft->fillScreen(BLACK);
+        endScroll();
+        gfx->fillScreen(BLACK);
+    }
+    currentPage = PAGE_NONE;
+    currentLayout = nullptr;
+    toastUntil = 0;
+    invalidateWidgets();
+}
+
+// 스크롤 해제 (패널 메모리 줄 = 화면 줄)
+void RemoteLCD::endScroll() {
+    if (!activeScroll) return;
+    requestScroll(activeScroll->top);
+    flushScroll();
+    activeScroll = nullptr;
+}
+
+bool RemoteLCD::beginPage(Page page, const LcdPageLayout& layout) {
+    if (!tft || page == currentPage) return false;
+    
+    pageStartUs = micros();
+    pageSwitching = true;
+    endScroll();
+    toastUntil = 0;
+    
+    // 저장본이 있으면 복사만, 없으면 그리기 목록 실행 후 저장 (PSRAM 부족 시 다음에도 목록)
+    pageFromCache = canvas && pageCache.restore(page, canvas);
+    if (!pageFromCache) {
+        gfx->fillScreen(BLACK);
+        drawLayout(layout);
+        if (canvas) pageCache.save(page, canvas);
+    }
+    
+    currentPage = page;
+    currentLayout = &layout;
+    invalidateWidgets();
+    return true;
+}
+
+void RemoteLCD::endPage() {
+    if (!pageSwitching) return;
+    pageSwitching = false;
+    
+    uint32_t us = micros() - pageStartUs;
+    pageStats.switches++;
+    if (pageFromCache) pageStats.cached++;
+    pageStats.lastUs = us;
+    if (us > pageStats.worstUs) {
+        pageStats.worstUs = us;
+    }
+    printf("페이지 %u 전환: %lu us (%s)\r\n", (unsigned)currentPage, (unsigned long)us,
+           pageFromCache ? "저장본" : "그리기 목록");
+}
+
+void RemoteLCD::drawLayout(const LcdPageLayout& layout) {
+    for (uint8_t i = 0; i < layout.count; i++) {
+        drawLayoutItem(layout.items[i]);
+    }
+}
+
+void RemoteLCD::drawLayoutItem(const LcdPageItem& item) {
+    switch (item.type) {
+        case LcdPageItem::TEXT: {
+            lcdtext::TextScale scale = 1;
+            scale.q8 = item.scaleQ8;
+            textRun.layout(item.text, scale);
+            drawTextRun(textRun, { item.x, item.y, item.w, item.h }, (lcdtext::TextAlign)item.align,
+                        item.color, BLACK);
+            break;
+        }
+        case LcdPageItem::HLINE:
+            gfx->drawFastHLine(item.x, item.y, item.w, item.color);
+            break;
+        case LcdPageItem::FILL_CIRCLE:
+            gfx->fillCircle(item.x, item.y, item.h, item.color);
+            break;
+    }
+}
+
+// 영역을 정적 레이어로 되돌림: 저장본 복사, 없으면 지우고 겹치는 목록 항목만 다시 그림
+void RemoteLCD::restoreBackground(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (canvas && pageCache.restoreRect(currentPage, canvas, x, y, w, h)) return;
+    
+    gfx->fillRect(x, y, w, h, BLACK);
+    if (!currentLayout) return;
+    
+    for (uint8_t i = 0; i < currentLayout->count; i++) {
+        const LcdPageItem& item = currentLayout->items[i];
+        int16_t top = item.type == LcdPageItem::FILL_CIRCLE ? item.y - item.h : item.y;
+        int16_t bottom = item.type == LcdPageItem::FILL_CIRCLE ? item.y + item.h + 1 : item.y + item.h;
+        if (bottom > y && top < y + h) {
+            drawLayoutItem(item);
+        }
     }
 }
 
+void RemoteLCD::showToast(const char* text, uint16_t color, uint16_t durationMs) {
+    if (!tft) return;
+    if (currentPage != PAGE_MAIN) {
+        printf("알림: %s\r\n", text);
+        return;
+    }
+    
+    gfx->fillRect(0, TOAST_Y, SCREEN_WIDTH, 16, BLACK);
+    drawString(text, SCREEN_WIDTH / 2, TOAST_Y, { color, 1, lcdtext::ALIGN_CENTER });
+    toastUntil = millis() + durationMs;
+    if (toastUntil == 0) toastUntil = 1;
+}
+
+// 화면이 다시 그려졌으므로 모든 위젯을 다음 값에서 다시 그림
+void RemoteLCD::invalidateWidgets() {
+    speedWidget.invalidate();
+    memset(speedShown, 0, sizeof(speedShown));
+    directionWidget.invalidate();
+    motorTempWidget.invalidate();
+    fetTempWidget.invalidate();
+    currentWidget.invalidate();
+    batteryWidget.invalidate();
+    batteryBar.invalidate();
+    rssiWidget.invalidate();
+    linkWidget.invalidate();
+}
+
 void RemoteLCD::setBrightness(uint8_t brightness) {
     // ST7789는 백라이트 제어를 위한 별도 핀 필요
     // 필요시 PWM으로 구현
 }
 
 void RemoteLCD::displayOn() {
-    if (tft) {
-        tft->enableDisplay(true);
-    }
+    sendCommand(ST77XX_DISPON, nullptr, 0);
 }
 
 void RemoteLCD::displayOff() {
-    if (tft) {
-        tft->enableDisplay(false);
-    }
+    sendCommand(ST77XX_DISPOFF, nullptr, 0);
 }
 
-void RemoteLCD::printText(const char* text, uint16_t x, uint16_t y, uint16_t color) {
-    if (tft) {
-        tft->setCursor(x, y);
-        tft->setTextColor(color);
-        tft->setTextSize(currentTextSize);
-        tft->print(text);
+void RemoteLCD::setFrameRate(uint8_t fps) {
+    framePeriodUs = fps ? 1000000UL / fps : 0;
+    lastFrameTime = micros();
+    
+    // 즉시 모드로 전환 시 대기 값 바로 반영
+    if (framePeriodUs == 0) {
+        flushWidgets();
     }
 }
 
-void RemoteLCD::printTextCentered(const char* text, uint16_t y, uint16_t color) {
-    if (tft) {
-        int16_t x1, y1;
-        uint16_t w, h;
-        tft->setTextSize(currentTextSize);
-        tft->getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+void RemoteLCD::resetFrameStats() {
+    frameStats.frames = 0;
+    frameStats.dropped = 0;
+    frameStats.coalesced = 0;
+    frameStats.lastFrameUs = 0;
+    frameStats.worstFrameUs = 0;
+}
+
+// 프레임 주기가 되면 대기 중인 위젯 갱신을 한꺼번에 그림
+void RemoteLCD::update() {
+    if (!tft) return;
+    
+    // 알림 시간이 지나면 머리 줄 배경 복원
+    if (toastUntil && (long)(millis() - toastUntil) >= 0) {
+        toastUntil = 0;
+        restoreBackground(0, TOAST_Y, SCREEN_WIDTH, 16);
+    }
+    
+    unsigned long now = micros();
+    
+    if (framePeriodUs) {
+        unsigned long elapsed = now - lastFrameTime;
+        if (elapsed < framePeriodUs) return;
         
-        uint16_t x = (SCREEN_WIDTH - w) / 2;
-        printText(text, x, y, color);
+        // loop()가 늦어 지나간 프레임
+        frameStats.dropped += elapsed / framePeriodUs - 1;
+        lastFrameTime = now - (elapsed % framePeriodUs);
+    }
+    else if (!canvas || !canvas->isDirty()) {
+        return;
+    }
+    
+    flush();
+    
+    uint32_t frameUs = micros() - now;
+    frameStats.frames++;
+    frameStats.lastFrameUs = frameUs;
+    if (frameUs > frameStats.worstFrameUs) {
+        frameStats.worstFrameUs = frameUs;
     }
 }
 
-void RemoteLCD::setTextSize(uint8_t size) {
-    currentTextSize = size;
+// 대기 중인 위젯 값을 그리고 프레임버퍼 변경 영역을 패널로 전송
+void RemoteLCD::flush() {
+    if (!tft) return;
+    
+    flushWidgets();
+    if (isConsoleShown()) {
+        drawConsoleLines();
+    }
+    
+    if (dma) {
+        // 새 줄이 큐에 들어간 뒤에만 스크롤 (같은 큐라 순서 보장)
+        if (dma->submit()) flushScroll();
+    } else if (canvas) {
+        canvas->flush(tft);
+        flushScroll();
+    }
+}
+
+bool RemoteLCD::sendCommand(uint8_t cmd, const uint8_t* data, uint8_t len) {
+    if (!tft) return false;
+    
+    if (dma) {
+        return dma->sendCommand(cmd, data, len);
+    }
+    tft->sendCommand(cmd, data, len);
+    return true;
+}
+
+void RemoteLCD::flushWidgets() {
+    // 다른 페이지에서는 대기 값을 그대로 두었다가 메인 화면 복귀 후 그림
+    if (currentPage != PAGE_MAIN) return;
+    
+    uint8_t u8;
+    int8_t i8;
+    int16_t i16;
+    uint16_t u16;
+    bool flag;
+    
+    // 대기 값은 draw*() 로 바로 그림 (show*() 는 다시 대기열로 보냄)
+    if (takeWidget(speedWidget, u8)) drawVehicleSpeed(u8);
+    if (takeWidget(directionWidget, u8)) drawVehicleDirection(u8);
+    if (takeWidget(motorTempWidget, i16)) drawMotorTemp(i16);
+    if (takeWidget(fetTempWidget, i16)) drawFetTemp(i16);
+    if (takeWidget(currentWidget, u16)) drawMotorCurrent(u16);
+    if (takeWidget(batteryWidget, u8)) drawBatteryLevel(u8);
+    if (takeWidget(rssiWidget, i8)) drawRSSI(i8);
+    if (takeWidget(linkWidget, flag)) drawConnectionStatus(flag);
+    
+    LcdTrendChart::Sample sample;
+    if (takeWidget(trendWidget, sample) && activeScroll == &trendChart.getScroll()) drawTrendRow(sample);
 }
 
 void RemoteLCD::showButtonStatus(uint8_t buttonId, bool pressed) {
@@ -83,47 +407,63 @@ void RemoteLCD::showButtonStatus(uint8_t buttonId, bool pressed) {
 
 void RemoteLCD::showConnectionStatus(bool connected) {
     if (!tft) return;
+    if (queueWidget(linkWidget, connected)) return;
+    drawConnectionStatus(connected);
+}
+
+void RemoteLCD::drawConnectionStatus(bool connected) {
+    if (!updateWidget(linkWidget, connected)) return;
+    
+    static constexpr auto TEXT_CONNECTED = LCD_TEXT("연결됨");
+    static constexpr auto TEXT_WAITING = LCD_TEXT("대기중");
     
     uint16_t color = connected ? GREEN : GRAY;
-    const char* status = connected ? "연결됨" : "대기중";
+    lcdtext::TextView status = connected ? TEXT_CONNECTED.view() : TEXT_WAITING.view();
     
     // LED 원 그리기
-    tft->fillCircle(20, 303, 5, BLACK);  // 기존 원 지우기
-    tft->fillCircle(20, 303, 5, color);  // 새 상태 원
+    gfx->fillCircle(20, 303, 5, BLACK);  // 기존 원 지우기
+    gfx->fillCircle(20, 303, 5, color);  // 새 상태 원
     
     // 연결 상태 영역 지우기
-    tft->fillRect(30, 300, 70, 16, BLACK);
+    gfx->fillRect(30, linkWidget.y, 70, linkWidget.h, BLACK);
     
     // 한글로 상태 표시
-    draw16String(30, 300, color, BLACK, status, 1, 0);
+    draw16Text(30, 300, color, BLACK, status, 1, 0);
 }
 
 void RemoteLCD::showBatteryLevel(uint8_t percentage) {
     if (!tft) return;
+    if (queueWidget(batteryWidget, percentage)) return;
+    drawBatteryLevel(percentage);
+}
+
+void RemoteLCD::drawBatteryLevel(uint8_t percentage) {
+    if (!updateWidget(batteryWidget, percentage)) return;
     
-    // 대형 배터리 진행바 (220x18)
-    drawProgressBar(10, 272, 220, 18, percentage);
+    // 대형 배터리 진행바 (220x18) - 늘어난/줄어든 띠만 그림
+    batteryBar.draw(gfx, percentage);
     
-    // 퍼센트 텍스트 (진행바 중앙)
+    // 퍼센트 텍스트 (진행바 위 오른쪽, 고정 4칸 + 배경으로 이전 값 덮어씀)
     char text[10];
-    sprintf(text, "%d%%", percentage);
-    
-    tft->fillRect(110, 275, 30, 12, BLACK);
-    tft->setCursor(110, 275);
-    tft->setTextSize(1);
-    tft->setTextColor(BLACK);  // 검정 배경에 검정 글자 (진행바 위에)
-    tft->print(text);
+    sprintf(text, "%3d%%", percentage);
+    drawString(text, batteryBar.x + batteryBar.w, batteryBar.y - 17, { WHITE, 1, lcdtext::ALIGN_RIGHT, true, BLACK });
 }
 
 void RemoteLCD::showRSSI(int8_t rssi) {
     if (!tft) return;
+    if (queueWidget(rssiWidget, rssi)) return;
+    drawRSSI(rssi);
+}
+
+void RemoteLCD::drawRSSI(int8_t rssi) {
+    if (!updateWidget(rssiWidget, rssi)) return;
     
     // RSSI 표시 (새 위치: 110, 300)
     char text[20];
     sprintf(text, "RSSI: %d dBm", rssi);
     
     // 이전 텍스트 지우기
-    tft->fillRect(110, 300, 120, 16, BLACK);
+    gfx->fillRect(rssiWidget.x, rssiWidget.y, rssiWidget.w, rssiWidget.h, BLACK);
     
     // RSSI 값에 따른 색상 결정
     uint16_t color;
@@ -135,46 +475,73 @@ void RemoteLCD::showRSSI(int8_t rssi) {
         color = RED;        // 약함
     }
     
-    tft->setCursor(110, 300);
-    tft->setTextSize(1);
-    tft->setTextColor(color);
-    tft->print(text);
+    drawString(text, rssiWidget.x, rssiWidget.y, { color });
 }
 
 void RemoteLCD::showVehicleSpeed(uint8_t speed) {
     if (!tft) return;
+    if (queueWidget(speedWidget, speed)) return;
+    drawVehicleSpeed(speed);
+}
+
+void RemoteLCD::drawVehicleSpeed(uint8_t speed) {
+    if (!updateWidget(speedWidget, speed)) return;
     
-    // 속도 숫자 영역 지우기 (초대형 4배 크기)
-    tft->fillRect(80, 90, 160, 35, BLACK);
-    
-    // 속도 표시 (초대형 72pt, 중앙 정렬)
-    char text[10];
-    sprintf(text, "%d", speed);
+    drawSpeedDigits(speed);
+}
+
+// 속도 숫자: 바뀐 칸만 미리 확대된 비트맵으로 덮어씀 (칸당 주소창 1회, 영역 지우기 없음)
+void RemoteLCD::drawSpeedDigits(uint8_t speed) {
+    char text[SPEED_DIGITS + 1];
+    snprintf(text, sizeof(text), "%*u", SPEED_DIGITS, speed);
     
-    tft->setTextSize(4);
-    tft->setTextColor(GREEN);
-    tft->setCursor(90, 90);
-    tft->print(text);
+    for (uint8_t i = 0; i < SPEED_DIGITS; i++) {
+        if (text[i] == speedShown[i]) continue;
+        speedShown[i] = text[i];
+        
+        int x = speedWidget.x + i * BigDigitFont::CELL_WIDTH;
+        if (text[i] == ' ') {
+            gfx->fillRect(x, speedWidget.y, BigDigitFont::CELL_WIDTH, BigDigitFont::CELL_HEIGHT, BLACK);
+            continue;
+        }
+        
+        beginText(x, speedWidget.y, GREEN, BLACK, 1, 0);
+        _times = 1;
+        blitGlyph(BigDigitFont::glyph(text[i] - '0'), BigDigitFont::CELL_WIDTH,
+                  BigDigitFont::CELL_HEIGHT, BigDigitFont::STRIDE);
+        endText();
+    }
 }
 
 void RemoteLCD::showVehicleDirection(uint8_t direction) {
     if (!tft) return;
+    if (queueWidget(directionWidget, direction)) return;
+    drawVehicleDirection(direction);
+}
+
+void RemoteLCD::drawVehicleDirection(uint8_t direction) {
+    static constexpr auto TEXT_STOP = LCD_TEXT("● 정지");
+    static constexpr auto TEXT_FORWARD = LCD_TEXT("▲ 전진");
+    static constexpr auto TEXT_BACKWARD = LCD_TEXT("▼ 후진");
+    static constexpr auto TEXT_UNKNOWN = LCD_TEXT("?? ??");
     
-    const char* dirText;
+    if (!updateWidget(directionWidget, direction)) return;
+    
+    lcdtext::TextView dirText;
     uint16_t color;
     
     switch (direction) {
-        case 0: dirText = "● 정지"; color = YELLOW; break;
-        case 1: dirText = "▲ 전진"; color = GREEN; break;
-        case 2: dirText = "▼ 후진"; color = RED; break;
-        default: dirText = "?? ??"; color = GRAY; break;
+        case 0: dirText = TEXT_STOP; color = YELLOW; break;
+        case 1: dirText = TEXT_FORWARD; color = GREEN; break;
+        case 2: dirText = TEXT_BACKWARD; color = RED; break;
+        default: dirText = TEXT_UNKNOWN; color = GRAY; break;
     }
     
     // 방향 표시 영역 지우기
-    tft->fillRect(85, 130, 150, 20, BLACK);
+    gfx->fillRect(directionWidget.x, directionWidget.y, directionWidget.w, directionWidget.h, BLACK);
     
     // 방향 아이콘 + 한글 (2배 확대)
-    draw16String(90, 130, color, BLACK, dirText, 2, 0);
+    draw16Text(90, 130, color, BLACK, dirText, 2, 0);
 }
 
 void RemoteLCD::showVehicleBattery(uint8_t percentage) {
@@ -184,107 +551,307 @@ void RemoteLCD::showVehicleBattery(uint8_t percentage) {
 
 void RemoteLCD::showMotorTemp(int16_t temp) {
     if (!tft) return;
+    if (queueWidget(motorTempWidget, temp)) return;
+    drawMotorTemp(temp);
+}
+
+void RemoteLCD::drawMotorTemp(int16_t temp) {
+    if (!updateWidget(motorTempWidget, temp)) return;
     
     char text[10];
     sprintf(text, "%d°C", temp);
     
     // 모터 온도 영역 지우기 (값만)
-    tft->fillRect(50, 220, 70, 16, BLACK);
+    gfx->fillRect(motorTempWidget.x, motorTempWidget.y, motorTempWidget.w, motorTempWidget.h, BLACK);
     
     // 색상 결정 (정상/경고/위험)
     uint16_t color = temp > 80 ? RED : (temp > 70 ? YELLOW : GREEN);
-    draw16String(50, 220, color, BLACK, text, 1, 0);
+    drawText(text, widgetBox(motorTempWidget), lcdtext::ALIGN_LEFT, color, BLACK);
 }
 
 void RemoteLCD::showMotorCurrent(uint16_t current) {
     if (!tft) return;
+    if (queueWidget(currentWidget, current)) return;  // 대기 값은 원래 값(mA 단위)
+    drawMotorCurrent(current);
+}
+
+void RemoteLCD::drawMotorCurrent(uint16_t current) {
+    // 표시 해상도(0.1A) 이하의 변화는 생략
+    if (!updateWidget(currentWidget, (uint16_t)(current / 10))) return;
     
     char text[15];
     float currentFloat = current / 100.0;
     sprintf(text, "%.1fA", currentFloat);
     
     // 전류 영역 지우기 (값만)
-    tft->fillRect(50, 240, 80, 16, BLACK);
+    gfx->fillRect(currentWidget.x, currentWidget.y, currentWidget.w, currentWidget.h, BLACK);
     
     // CYAN 색상으로 표시
-    draw16String(50, 240, CYAN, BLACK, text, 1, 0);
+    drawText(text, widgetBox(currentWidget), lcdtext::ALIGN_LEFT, CYAN, BLACK);
 }
 
 void RemoteLCD::showFetTemp(int16_t temp) {
     if (!tft) return;
+    if (queueWidget(fetTempWidget, temp)) return;
+    drawFetTemp(temp);
+}
+
+void RemoteLCD::drawFetTemp(int16_t temp) {
+    if (!updateWidget(fetTempWidget, temp)) return;
     
     char text[10];
     sprintf(text, "%d°C", temp);
     
     // FET 온도 영역 지우기 (값만)
-    tft->fillRect(165, 220, 70, 16, BLACK);
+    gfx->fillRect(fetTempWidget.x, fetTempWidget.y, fetTempWidget.w, fetTempWidget.h, BLACK);
     
     // 색상 결정
     uint16_t color = temp > 80 ? RED : (temp > 70 ? YELLOW : GREEN);
-    draw16String(165, 220, color, BLACK, text, 1, 0);
+    drawText(text, widgetBox(fetTempWidget), lcdtext::ALIGN_LEFT, color, BLACK);
 }
 
-void RemoteLCD::drawMainScreen() {
+void RemoteLCD::addTrendSample(int16_t motorTemp, int16_t fetTemp, uint16_t current) {
     if (!tft) return;
     
-    clear();
+    // 컴포지터가 꺼져 있으면 버림: 호출자는 ESP-NOW 수신 태스크라 여기서 줄 쓰기/스크롤 명령을 보내면
+    // loop() 쪽 SPI 전송과 겹침 (그래프는 컴포지터 프레임에서만 그림)
+    LcdTrendChart::Sample sample = {{ motorTemp, fetTemp, current }};
+    queueWidget(trendWidget, sample);
+}
+
+// 스크롤 영역 정의 + 빈 그래프 (화면 전환 시 1회)
+void RemoteLCD::beginTrendChart() {
+    const LcdScrollRegion& scroll = trendChart.getScroll();
+    trendChart.reset();
     
-    // ========== 헤더 (0-60) ==========
-    // 제목 (한글 16x16, 3배 확대 = 48x48)
-    int titleWidth = draw16Length("YCB AI 전동차", 1.5);
-    int titleX = (SCREEN_WIDTH - titleWidth) / 2;
-    draw16String(titleX, 10, CYAN, BLACK, "YCB AI 전동차", 1.5, 0);
+    trendChart.renderBlankRow(lineBuffer);
+    for (uint16_t row = 0; row < scroll.rows; row++) {
+        writeChartRow(scroll.top + row);
+    }
+    beginScroll(scroll);
+}
+
+// 새 샘플 1줄 → 스크롤 영역의 다음 메모리 줄, 이어서 시작 주소 이동
+void RemoteLCD::drawTrendRow(const LcdTrendChart::Sample& sample) {
+    int16_t y = trendChart.renderRow(sample, lineBuffer);
+    writeChartRow(y);
+    requestScroll(trendChart.getScroll().getAddress());
+}
+
+// lineBuffer → 패널 메모리 줄 y (스크롤과 무관한 실제 주소)
+void RemoteLCD::writeChartRow(int16_t y) {
+    if (canvas) {
+        canvas->writeLine565(0, y, trendChart.width, lineBuffer);
+        return;
+    }
     
-    tft->drawFastHLine(0, 60, SCREEN_WIDTH, GRAY);
+    tft->startWrite();
+    tft->setAddrWindow(0, y, trendChart.width, 1);
+    tft->writePixels(lineBuffer, trendChart.width);
+    tft->endWrite();
+}
+
+void RemoteLCD::showConsole() {
+    if (!tft) return;
     
-    // ========== 속도 영역 (70-150) ==========
-    // 라벨 "속도 (km/h)"
-    int speedLabelWidth = draw16Length("속도 (km/h)", 1);
-    int speedLabelX = (SCREEN_WIDTH - speedLabelWidth) / 2;
-    draw16String(speedLabelX, 70, WHITE, BLACK, "속도 (km/h)", 1, 0);
+    static constexpr auto TEXT_CONSOLE = LCD_TEXT("진단 콘솔");
+    static constexpr LcdPageItem ITEMS[] = {
+        LcdPageItem::centered(TEXT_CONSOLE, 4, CYAN),
+        LcdPageItem::hline(0, 22, SCREEN_WIDTH, GRAY),     // 스크롤 영역(24~) 바로 위
+    };
+    static constexpr LcdPageLayout LAYOUT = { ITEMS, sizeof(ITEMS) / sizeof(ITEMS[0]) };
     
-    // 속도 숫자 (초대형 4배) - 초기값 0
-    tft->setTextSize(4);
-    tft->setTextColor(GREEN);
-    tft->setCursor(90, 90);
-    tft->print("0");
+    if (!beginPage(PAGE_CONSOLE, LAYOUT)) return;
     
-    // 방향 표시 (초기: 정지)
-    draw16String(90, 130, YELLOW, BLACK, "● 정지", 2, 0);
+    // 화면 칸 수만큼 최근 줄부터 (정적 레이어의 스크롤 영역은 비어 있음)
+    consoleScroll.reset();
+    uint32_t last = console.getHead();
+    uint16_t slots = consoleScroll.getSlots();
+    consoleNext = last >= slots ? last - slots + 1 : 1;
     
+    beginScroll(consoleScroll);
+    drawConsoleLines();
+    endPage();
+}
+
+void RemoteLCD::drawMenu(LcdMenu& menu, uint8_t selected) {
+    if (!tft) return;
+    
+    bool full = !menu.isValid();
+    uint8_t from = menu.getSelected();
+    uint8_t rows[LcdMenu::MAX_ROWS];
+    uint8_t count = menu.select(selected, rows);
+    
+    for (uint8_t i = 0; i < count; i++) {
+        drawMenuRow(menu, rows[i]);
+    }
+    
+    // 줄을 그린 뒤 창 이동 (프레임버퍼면 flush() 에서 줄 전송 후)
+    if (menu.isScrollable()) {
+        if (full) {
+            beginScroll(menu.getScroll());
+        } else if (menu.isScrolled()) {
+            requestScroll(menu.getScroll().getAddress());
+        }
+    }
+    
+    // 이동 1회당 다시 그린 영역 (전체 화면 = 240x320)
+    printf("메뉴 %u → %u: %u줄, %lu 픽셀%s\r\n", (unsigned)from, (unsigned)menu.getSelected(), (unsigned)count,
+           (unsigned long)count * SCREEN_WIDTH * 16, full ? " (전체)" : (menu.isScrolled() ? " (스크롤)" : ""));
+}
+
+// 선택 표시 + 항목 글자, 남은 폭은 지움 (스크롤 칸에는 다른 항목이 있었을 수 있음)
+void RemoteLCD::drawMenuRow(const LcdMenu& menu, uint8_t index) {
+    int16_t y = menu.rowY(index);
+    bool selected = index == menu.getSelected();
+    
+    drawString(selected ? ">" : " ", 5, y, { GREEN, 1, lcdtext::ALIGN_LEFT, true, BLACK });
+    int w = drawString(menu.getItem(index), 20, y, { selected ? YELLOW : WHITE, 1, lcdtext::ALIGN_LEFT, true, BLACK });
+    if (20 + w < SCREEN_WIDTH) {
+        gfx->fillRect(20 + w, y, SCREEN_WIDTH - 20 - w, 16, BLACK);
+    }
+}
+
+// 새로 들어온 줄을 스크롤 영역 다음 칸에 1줄씩 (flush() 에서 프레임마다)
+void RemoteLCD::drawConsoleLines() {
+    char text[DiagConsole::LINE_BYTES];
+    uint16_t slots = consoleScroll.getSlots();
+    
+    // 한 화면보다 많이 밀렸으면 어차피 지나갈 줄은 건너뜀
+    uint32_t last = console.getHead();
+    if (last >= consoleNext + slots) {
+        consoleNext = last - slots + 1;
+    }
+    
+    bool drawn = false;
+    while (console.read(consoleNext, text)) {
+        int16_t y = consoleScroll.advance();
+        int w = drawString(text, 0, y, { WHITE, 1, lcdtext::ALIGN_LEFT, true, BLACK });
+        if (w < SCREEN_WIDTH) {
+            gfx->fillRect(w, y, SCREEN_WIDTH - w, consoleScroll.step, BLACK);
+        }
+        drawn = true;
+    }
+    
+    if (drawn) {
+        requestScroll(consoleScroll.getAddress());
+    }
+}
+
+// 스크롤 영역 정의 (VSCRDEF) + 시작 주소 = 영역 처음
+void RemoteLCD::beginScroll(const LcdScrollRegion& region) {
+    uint8_t data[6];
+    region.getDefinitionData(SCREEN_HEIGHT, data);
+    sendCommand(LcdScrollRegion::CMD_VSCRDEF, data, 6);
+    
+    activeScroll = &region;
+    requestScroll(region.getAddress());
+}
+
+// 프레임버퍼는 flush() 에서 줄 전송 후 스크롤, 직접 그리기는 바로
+void RemoteLCD::requestScroll(uint16_t address) {
+    pendingScrollAddress = address;
+    scrollPending = true;
+    if (!canvas) flushScroll();
+}
+
+void RemoteLCD::flushScroll() {
+    if (!scrollPending) return;
+    
+    uint8_t data[2] = { (uint8_t)(pendingScrollAddress >> 8), (uint8_t)(pendingScrollAddress & 0xFF) };
+    if (sendCommand(LcdScrollRegion::CMD_VSCSAD, data, 2)) {
+        scrollPending = false;
+    }
+}
+
+void RemoteLCD::drawMainScreen() {
+    if (!tft) return;
     
-    // ========== 온도/전류 영역 (220-255) ==========
-    // 첫 번째 줄: 모터, FET
-    draw16String(10, 220, GRAY, BLACK, "모터", 1, 0);
-    draw16String(50, 220, WHITE, BLACK, "--°C", 1, 0);
-    draw16String(135, 220, GRAY, BLACK, "FET", 1, 0);
-    draw16String(165, 220, WHITE, BLACK, "--°C", 1, 0);
+    // 정적 레이어 (컴파일 타임 디코딩, 값 자리는 "--" 표시)
+    static constexpr auto TEXT_TITLE = LCD_TEXT("YCB AI 전동차");
+    static constexpr auto TEXT_LINK = LCD_TEXT("ESP-NOW + CAN(500k)");
+    static constexpr auto TEXT_SPEED_LABEL = LCD_TEXT("속도 (km/h)");
+    static constexpr auto TEXT_STOP = LCD_TEXT("● 정지");
+    static constexpr auto TEXT_MOTOR = LCD_TEXT("모터");
+    static constexpr auto TEXT_FET = LCD_TEXT("FET");
+    static constexpr auto TEXT_TEMP_NONE = LCD_TEXT("--°C");
+    static constexpr auto TEXT_CURRENT = LCD_TEXT("전류");
+    static constexpr auto TEXT_CURRENT_NONE = LCD_TEXT("--A");
+    static constexpr auto TEXT_BATTERY = LCD_TEXT("배터리");
+    static constexpr auto TEXT_WAITING = LCD_TEXT("대기중");
+    static constexpr auto TEXT_RSSI_NONE = LCD_TEXT("RSSI: --");
+    static constexpr auto TEXT_HINT = LCD_TEXT("SELECT 3초 길게 누르면 설정");
     
-    // 두 번째 줄: 전류
-    draw16String(10, 240, GRAY, BLACK, "전류", 1, 0);
-    draw16String(50, 240, CYAN, BLACK, "--A", 1, 0);
+    static constexpr LcdPageItem ITEMS[] = {
+        // ========== 헤더 (0-60), 통신 방식 줄은 알림 자리 겸용 ==========
+        LcdPageItem::centered(TEXT_TITLE, 10, CYAN, 1.5),
+        LcdPageItem::centered(TEXT_LINK, TOAST_Y, GRAY),
+        LcdPageItem::hline(0, 60, SCREEN_WIDTH, GRAY),
+        
+        // ========== 속도 영역 (70-162) ==========
+        LcdPageItem::centered(TEXT_SPEED_LABEL, 70, WHITE),
+        LcdPageItem::label(TEXT_STOP, 90, 130, YELLOW, 2),
+        
+        // ========== 온도/전류 영역 (220-255), 라벨 색 = 그래프 계열 색 ==========
+        LcdPageItem::label(TEXT_MOTOR, 10, 220, YELLOW),
+        LcdPageItem::label(TEXT_TEMP_NONE, 50, 220, WHITE),
+        LcdPageItem::label(TEXT_FET, 135, 220, MAGENTA),
+        LcdPageItem::label(TEXT_TEMP_NONE, 165, 220, WHITE),
+        LcdPageItem::label(TEXT_CURRENT, 10, 240, CYAN),
+        LcdPageItem::label(TEXT_CURRENT_NONE, 50, 240, CYAN),
+        LcdPageItem::label(TEXT_BATTERY, 10, 255, WHITE),
+        
+        // ========== 통신 상태 (295-) ==========
+        LcdPageItem::circle(20, 303, 5, GRAY),
+        LcdPageItem::label(TEXT_WAITING, 30, 300, GRAY),
+        LcdPageItem::label(TEXT_RSSI_NONE, 110, 300, GRAY),
+        LcdPageItem::label(TEXT_HINT, 20, 315, GRAY, 0.6),
+    };
+    static constexpr LcdPageLayout LAYOUT = { ITEMS, sizeof(ITEMS) / sizeof(ITEMS[0]) };
     
-    // 배터리 레이블
-    draw16String(10, 260, WHITE, BLACK, "배터리", 1, 0);
+    SpiStats before = totalTextStats;
     
-    // 배터리 진행바 (대형 220x20)
-    drawProgressBar(10, 272, 220, 18, 100);
+    if (!beginPage(PAGE_MAIN, LAYOUT)) return;
     
+    // ========== 동적 부분: 추세 그래프 (166-215, 하드웨어 스크롤) + 위젯 마지막 값 ==========
+    beginTrendChart();
+    restoreWidgets();
+    endPage();
     
-    // ========== 통신 상태 (295-) ==========
-    // 연결 상태 (LED + 텍스트)
-    tft->fillCircle(20, 303, 5, GRAY);  // 초기 상태: 회색
-    draw16String(30, 300, GRAY, BLACK, "대기중", 1, 0);
+    // 텍스트 렌더링 SPI 비용
+    printf("메인화면 텍스트 SPI: %lu 트랜잭션, %lu 바이트\r\n",
+           (unsigned long)(totalTextStats.transactions - before.transactions),
+           (unsigned long)(totalTextStats.bytes - before.bytes));
+    printf("한글 캐시: 히트 %lu, 미스 %lu / 배율 글리프: 히트 %lu, 미스 %lu\r\n",
+           (unsigned long)hangulCache.getHits(), (unsigned long)hangulCache.getMisses(),
+           (unsigned long)scaledCache.getHits(), (unsigned long)scaledCache.getMisses());
+    printf("위젯: 그림 %lu, 생략 %lu\r\n",
+           (unsigned long)widgetStats.redraws, (unsigned long)widgetStats.skipped);
+    printf("프레임: %lu (누락 %lu, 병합 %lu), 최근 %lu us, 최악 %lu us\r\n",
+           (unsigned long)frameStats.frames, (unsigned long)frameStats.dropped,
+           (unsigned long)frameStats.coalesced, (unsigned long)frameStats.lastFrameUs,
+           (unsigned long)frameStats.worstFrameUs);
+}
+
+// 페이지 복귀: 마지막으로 그린 값을 대기 값으로 되돌려 바로 다시 그림
+// (다른 페이지에 있는 동안 들어온 새 값이 대기 중이면 그 값이 우선)
+void RemoteLCD::restoreWidgets() {
+    portENTER_CRITICAL(&widgetLock);
+    if (speedWidget.hasValue()) speedWidget.restore(speedWidget.getValue());
+    if (directionWidget.hasValue()) directionWidget.restore(directionWidget.getValue());
+    if (motorTempWidget.hasValue()) motorTempWidget.restore(motorTempWidget.getValue());
+    if (fetTempWidget.hasValue()) fetTempWidget.restore(fetTempWidget.getValue());
+    if (currentWidget.hasValue()) currentWidget.restore(currentWidget.getValue() * 10);  // 대기 값은 mA
+    if (batteryWidget.hasValue()) batteryWidget.restore(batteryWidget.getValue());
+    if (rssiWidget.hasValue()) rssiWidget.restore(rssiWidget.getValue());
+    if (linkWidget.hasValue()) linkWidget.restore(linkWidget.getValue());
+    portEXIT_CRITICAL(&widgetLock);
     
-    // RSSI
-    tft->setCursor(110, 300);
-    tft->setTextSize(1);
-    tft->setTextColor(GRAY);
-    tft->print("RSSI: --");
+    // 아직 값이 없는 그래픽 위젯은 초기 모양 (글자 위젯의 "--" 는 정적 레이어에 있음)
+    if (!speedWidget.hasValue()) drawSpeedDigits(0);
+    if (!batteryWidget.hasValue()) batteryBar.draw(gfx, 100);
     
-    // 설정 힌트
-    draw16String(20, 315, GRAY, BLACK, "SELECT 3초 길게 누르면 설정", 0.6, 0);
-    draw16String(10, 280, GRAY, BLACK, "ESP-NOW + CAN(500k)", 1, 0);
+    flushWidgets();
 }
 
 // drawButton 함수 제거됨 - 버튼 표시를 LCD에서 하지 않음
@@ -294,183 +861,365 @@ void RemoteLCD::drawProgressBar(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
     if (!tft) return;
     
     // 테두리
-    tft->drawRect(x, y, w, h, WHITE);
+    gfx->drawRect(x, y, w, h, WHITE);
     
     // 배경
-    tft->fillRect(x+2, y+2, w-4, h-4, BLACK);
+    gfx->fillRect(x+2, y+2, w-4, h-4, BLACK);
     
     // 진행 바
     uint16_t barWidth = ((w - 4) * percentage) / 100;
     uint16_t barColor = percentage > 20 ? GREEN : RED;
     
-    tft->fillRect(x+2, y+2, barWidth, h-4, barColor);
+    gfx->fillRect(x+2, y+2, barWidth, h-4, barColor);
 }
 
 // =============================================================================
 // 한글 폰트 지원 (16x16 조합형)
 // =============================================================================
 
-#include "font/english.h"
-#include "font/kssm_font.h"
+#include "PackedFont.h"
 
-void RemoteLCD::setPixel(uint16_t x, uint16_t y, uint16_t color) {
-    if (tft) {
-        tft->drawPixel(x, y, color);
-    }
-}
+// 대체 글리프 (폰트 파티션이 없을 때): 빈 사각형, 줄 단위 MSB=왼쪽
+static const uint8_t FALLBACK_WIDE[32] = {
+    0x00, 0x00, 0x3F, 0xFC, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04,
+    0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x20, 0x04, 0x3F, 0xFC, 0x00, 0x00
+};
+static const uint8_t FALLBACK_NARROW[16] = {
+    0x00, 0x00, 0x7E, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x7E, 0x00, 0x00
+};
 
 void RemoteLCD::fillRect16(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
     if (tft) {
-        tft->fillRect(x, y, w, h, color);
+        gfx->fillRect(x, y, w, h, color);
     }
 }
 
-// 8x16 영문 렌더링
-void RemoteLCD::draw16English(uint8_t ch) {
-    if (!tft) return;
+void RemoteLCD::resetTextStats() {
+    lastTextStats.transactions = 0;
+    lastTextStats.bytes = 0;
+    totalTextStats.transactions = 0;
+    totalTextStats.bytes = 0;
+}
+
+// 1bpp 글리프(height줄, MSB=왼쪽)를 _times 배율로 한번에 전송
+// 배경 있음: 주소창 1회 + writePixels 연속 전송 (프레임버퍼 모드: 줄 단위 복사)
+// 배경 없음(_nobg): 켜진 픽셀 구간만 writeFillRect
+void RemoteLCD::blitGlyph(const uint8_t* bits, uint8_t width, uint8_t height, uint8_t stride) {
+    int gw = width * _times;
+    int gh = height * _times;
+    
+    // 한 줄 버퍼(화면 폭)보다 넓은 배율은 지원하지 않음
+    if (gw > SCREEN_WIDTH) return;
+    
+    // 출력 영역(기본: 화면, drawTextRun: 상자)으로 클리핑
+    int x0 = _xchar < clipX0 ? clipX0 : _xchar;
+    int y0 = _ychar < clipY0 ? clipY0 : _ychar;
+    int x1 = _xchar + gw > clipX1 ? clipX1 : _xchar + gw;
+    int y1 = _ychar + gh > clipY1 ? clipY1 : _ychar + gh;
+    if (x0 >= x1 || y0 >= y1) return;
+    
+    gfx->startWrite();
     
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 8; j++) {
-            for (int xx = 0; xx < _times; xx++) {
-                for (int k = 0; k < 8; k++) {
-                    uint8_t data = (english[ch][i * 8 + k]) & (1 << j);
-                    if (data) {
-                        for (int t = 0; t < _times; t++) {
-                            setPixel(_xchar + j * _times + xx, _ychar + (i * 8 + k) * _times + t, fg_color);
-                        }
-                    }
-                    else if (!_nobg) {
-                        for (int t = 0; t < _times; t++) {
-                            setPixel(_xchar + j * _times + xx, _ychar + (i * 8 + k) * _times + t, bg_color);
-                        }
-                    }
+    if (!_nobg) {
+        uint16_t w = x1 - x0;
+        if (!canvas) {
+            tft->setAddrWindow(x0, y0, w, y1 - y0);
+        }
+        
+        // 확장은 글리프 전체 폭으로 하고 보이는 부분부터 전송
+        const uint16_t* visible = lineBuffer + (x0 - _xchar);
+        
+        for (int row = 0; row < height; row++) {
+            int py = _ychar + row * _times;
+            if (py + _times <= y0 || py >= y1) continue;
+            
+            // 한 줄 확장 (표 변환 + 열 복제)
+            GlyphKernel::expandRow(bits + row * stride, width, _times, fg_color, bg_color, lineBuffer);
+            
+            // 세로 배율만큼 같은 줄 반복 전송
+            for (int t = 0; t < _times; t++) {
+                if (py + t < y0 || py + t >= y1) continue;
+                if (canvas) {
+                    canvas->writeLine565(x0, py + t, w, visible);
+                } else {
+                    tft->writePixels((uint16_t*)visible, w);
+                }
+            }
+        }
+        if (!canvas) {
+            lastTextStats.bytes += ADDR_WINDOW_BYTES + 2UL * w * (y1 - y0);
+        }
+    }
+    else {
+        for (int row = 0; row < height; row++) {
+            const uint8_t* src = bits + row * stride;
+            int col = 0;
+            while (col < width) {
+                // 켜진 픽셀 구간 탐색
+                if (!(src[col >> 3] & (0x80 >> (col & 7)))) {
+                    col++;
+                    continue;
+                }
+                int start = col;
+                while (col < width && (src[col >> 3] & (0x80 >> (col & 7)))) col++;
+                
+                // 출력 영역으로 클리핑
+                int rx0 = _xchar + start * _times;
+                int rx1 = _xchar + col * _times;
+                int ry0 = _ychar + row * _times;
+                int ry1 = ry0 + _times;
+                if (rx0 < x0) rx0 = x0;
+                if (rx1 > x1) rx1 = x1;
+                if (ry0 < y0) ry0 = y0;
+                if (ry1 > y1) ry1 = y1;
+                if (rx0 >= rx1 || ry0 >= ry1) continue;
+                
+                gfx->writeFillRect(rx0, ry0, rx1 - rx0, ry1 - ry0, fg_color);
+                if (!canvas) {
+                    lastTextStats.bytes += ADDR_WINDOW_BYTES + 2UL * (rx1 - rx0) * (ry1 - ry0);
                 }
             }
         }
     }
     
-    _xchar += 8 * _times;
-    if (_xchar > (SCREEN_WIDTH - (8 * _times))) {
-        _xchar = 0;
-        _ychar += 16 * _times;
+    gfx->endWrite();
+    if (!canvas) {
+        lastTextStats.transactions++;
     }
 }
 
-// 16x16 한글 조합형 렌더링
-void RemoteLCD::draw16Korean(uint16_t hangeul) {
+// 8x16 영문 렌더링
+void RemoteLCD::draw16English(uint8_t ch) {
     if (!tft) return;
     
-    uint8_t cho1[22] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 3, 3, 1, 2, 4, 4, 4, 2, 1, 3, 0 };
-    uint8_t cho2[22] = { 0, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 6, 6, 7, 7, 7, 6, 6, 7, 5 };
-    uint8_t jong[22] = { 0, 0, 2, 0, 2, 1, 2, 1, 2, 3, 0, 2, 1, 3, 3, 1, 2, 1, 3, 3, 1, 1 };
-
-    uint8_t first = 0, mid = 0, last = 0;
-    uint8_t firstType = 0, midType = 0, lastType = 0;
-    uint8_t Korean_buffer[32] = {0,};
-
-    // 초성(20) : 없음ㄱㄲㄴㄷㄸㄹㅁㅂㅃㅅㅆㅇㅈㅉㅊㅋㅌㅍㅎ
-    // 중성(22) : 없음ㅏㅐㅑㅒㅓㅔㅕㅖㅗㅘㅙㅚㅛㅜㅝㅞㅟㅠㅡㅢㅣ
-    // 종성(28) : 없음ㄱㄲㄳㄴㄵㄶㄷㄹㄺㄻㄼㄽㄾㄿㅀㅁㅂㅄㅅㅆㅇㅈㅊㅋㅌㅍㅎ
+    // 압축 폰트 디코딩 (비트 순서 변환은 생성 시 완료)
+    uint8_t glyph[PackedFont::ENGLISH_BYTES];
+    PackedFont::decodeEnglish(ch, glyph);
+    
+    drawScaledGlyph(ch, glyph, 8, 1);
+}
 
-    hangeul -= 0xAC00;    // 0xAC00='가' ~  0xD7A3='힣' 11,172글자
-    last = hangeul % 28;  // 종성
-    hangeul /= 28;
-    first = hangeul / 21 + 1;  // 초성
-    mid   = hangeul % 21 + 1;  // 중성
+// 16x16 한글 조합 → 줄 단위 32바이트 비트맵 (MSB=왼쪽)
+// part: 초·중·종성 K_font 인덱스 (lcdtext::hangulParts, 0 = 빈 글리프)
+void RemoteLCD::composeHangul(const uint16_t* part, uint8_t* glyph) {
+    // 압축 자모는 줄 단위로 재배치된 상태 → 0이 아닌 바이트만 OR
+    memset(glyph, 0, PackedFont::HANGUL_BYTES);
+    for (int i = 0; i < 3; i++) {
+        if (part[i]) PackedFont::orHangulPart(part[i], glyph);
+    }
+}
 
-    if (last == 0) {  // 받침 없는 경우
-        firstType = cho1[mid];
-        if (first == 1 || first == 24) midType = 0;
-        else midType = 1;
+// 16x16 한글 조합형 렌더링 (캐시 우선)
+void RemoteLCD::draw16Korean(const lcdtext::TextGlyph& g) {
+    if (!tft) return;
+    
+    // 폰트 파티션의 완성형 글리프 (조합/복사 없음)
+    uint8_t width, stride;
+    const uint8_t* mapped = fontPartition.find(g.code, width, stride);
+    if (mapped && width == 16) {
+        drawScaledGlyph(g.code, mapped, 16, stride);
+        return;
     }
-    else {  // 받침 있는 경우
-        firstType = cho2[mid];
-        if (first == 1 || first == 24) midType = 2;
-        else midType = 3;
-        lastType = jong[mid];
+    
+    const uint8_t* glyph = hangulCache.find(g.code);
+    uint8_t local[HangulGlyphCache::GLYPH_BYTES];
+    
+    if (!glyph) {
+        uint8_t* slot = hangulCache.insert(g.code);
+        if (!slot) slot = local;  // 캐시 비활성
+        composeHangul(g.part, slot);
+        glyph = slot;
     }
 
-    // 초성(0~159)
-    uint16_t pF_temp = firstType * 20 + first;
-    for (int i = 0; i < 32; i++) Korean_buffer[i] = (K_font[pF_temp][i]);
-
-    // 중성(160~247)
-    pF_temp = 160 + midType * 22 + mid;
-    for (int i = 0; i < 32; i++) Korean_buffer[i] |= (K_font[pF_temp][i]);
+    // TFT-LCD 출력
+    drawScaledGlyph(g.code, glyph, 16, 2);
+}
 
-    // 종성(247~359)
-    if (last) {
-        pF_temp = 248 + lastType * 28 + last;
-        for (int i = 0; i < 32; i++) Korean_buffer[i] |= (K_font[pF_temp][i]);
+// 1배 글리프를 현재 배율로 출력 후 커서 이동
+// 정수 배율: 열/줄 복제로 바로 블릿
+// 비정수 배율: (글리프, 배율)당 한 번 리샘플해 캐시 → 이후 1배 블릿 (픽셀 단위 배율 연산 없음)
+void RemoteLCD::drawScaledGlyph(uint16_t code, const uint8_t* bits, uint8_t width, uint8_t stride) {
+    int advance = (width * _scaleQ8 + 128) >> 8;
+    int lineHeight = (16 * _scaleQ8 + 128) >> 8;
+    
+    if ((_scaleQ8 & 0xFF) == 0) {
+        _times = _scaleQ8 >> 8;
+        blitGlyph(bits, width, 16, stride);
     }
-
-    // TFT-LCD 출력
-    for (int i = 0; i < 16; i++) {
-        for (int xx = 0; xx < _times; xx++) {
-            uint16_t data = (Korean_buffer[i] << 8) | Korean_buffer[i + 16];
-            for (int j = 0; j < 16; j++) {
-                if (data & 0x8000) {
-                    for (int t = 0; t < _times; t++) {
-                        setPixel(_xchar + j * _times, _ychar + i * _times + xx, fg_color);
-                    }
-                }
-                else if (!_nobg) {
-                    for (int t = 0; t < _times; t++) {
-                        setPixel(_xchar + j * _times, _ychar + i * _times + xx, bg_color);
-                    }
-                }
-                data <<= 1;
+    else if (advance > 0 && lineHeight > 0) {
+        ScaledGlyphCache::Entry scaled;
+        uint8_t local[ScaledGlyphCache::GLYPH_BYTES];
+        
+        if (!scaledCache.find(code, _scaleQ8, scaled)) {
+            if (!scaledCache.insert(code, _scaleQ8, advance, lineHeight, scaled)) {
+                // 캐시 비활성: 임시 버퍼에 리샘플
+                scaled.width = advance;
+                scaled.height = lineHeight;
+                scaled.stride = (advance + 7) >> 3;
+                scaled.bits = local;
+            }
+            
+            if (scaled.width <= ScaledGlyphCache::MAX_DIM && scaled.height <= ScaledGlyphCache::MAX_DIM) {
+                GlyphKernel::resample(bits, width, 16, stride, scaled.bits, scaled.width, scaled.height);
+            } else {
+                scaled.bits = nullptr;
             }
         }
+        
+        if (scaled.bits) {
+            _times = 1;
+            blitGlyph(scaled.bits, scaled.width, scaled.height, scaled.stride);
+        } else {
+            // 3배 초과 비정수 배율: 가까운 정수 배율로 대체
+            _times = (_scaleQ8 + 128) >> 8;
+            blitGlyph(bits, width, 16, stride);
+        }
     }
+    
+    // 줄바꿈 없음: 넘친 글자는 출력 영역에서 잘림
+    _xchar += advance;
+}
+
+// 기호/Latin-1 렌더링 (폰트 파티션, 없으면 대체 글리프)
+void RemoteLCD::draw16Symbol(const lcdtext::TextGlyph& g) {
+    if (!tft) return;
+    
+    uint8_t width, stride;
+    const uint8_t* glyph = fontPartition.find(g.code, width, stride);
+    
+    if (!glyph || width != g.advance) {
+        glyph = fontPartition.find(0xFFFD, width, stride);
+        if (!glyph || width != g.advance) {
+            // 파티션 없음: 내장 사각형
+            width = g.advance;
+            stride = width / 8;
+            glyph = width == 8 ? FALLBACK_NARROW : FALLBACK_WIDE;
+        }
+    }
+    
+    drawScaledGlyph(g.code, glyph, width, stride);
+}
 
-    _xchar += 16 * _times;
-    if (_xchar > (SCREEN_WIDTH - 16 * _times)) {
-        _xchar = 0;
-        _ychar += 16 * _times;
+void RemoteLCD::draw16Glyph(const lcdtext::TextGlyph& glyph) {
+    if (glyph.code < 0x80) {
+        draw16English(glyph.part[0]);
+    } else if (glyph.code >= lcdtext::HANGUL_FIRST && glyph.code <= lcdtext::HANGUL_LAST) {
+        draw16Korean(glyph);
+    } else {
+        draw16Symbol(glyph);
     }
 }
 
 // UTF-8 문자열 렌더링 (영문 + 한글)
-int RemoteLCD::draw16String(int x, int y, uint16_t fgColor, uint16_t bgColor, const char* str, uint8_t timesX, uint8_t nobg) {
+int RemoteLCD::draw16String(int x, int y, uint16_t fgColor, uint16_t bgColor, const char* str, lcdtext::TextScale scale, uint8_t nobg) {
     int length = 0;
+    beginText(x, y, fgColor, bgColor, scale, nobg);
+
+    while (*str) {
+        uint32_t code = 0;
+        str += lcdtext::decodeUtf8(str, code);
+        lcdtext::TextGlyph glyph = lcdtext::makeGlyph(code);
+        draw16Glyph(glyph);
+        length += scale.apply(glyph.advance);
+    }
+    
+    endText();
+    return length;
+}
+
+// 컴파일 타임 문자열 렌더링 (이미 디코딩된 글리프)
+int RemoteLCD::draw16Text(int x, int y, uint16_t fgColor, uint16_t bgColor, lcdtext::TextView text, lcdtext::TextScale scale, uint8_t nobg) {
+    beginText(x, y, fgColor, bgColor, scale, nobg);
+
+    for (uint8_t i = 0; i < text.count; i++) {
+        draw16Glyph(text.glyphs[i]);
+    }
+    
+    endText();
+    return lcdtext::scaledWidth(text, scale);
+}
+
+// 배치된 글리프 열을 상자 안에 정렬해 출력 (디코딩/폭 계산 없음)
+// 상자 밖으로 나가는 부분은 잘리고 줄바꿈하지 않음. 반환: 시작 x
+int RemoteLCD::drawTextRun(const lcdtext::TextRun& run, const lcdtext::TextBox& box, lcdtext::TextAlign align,
+                           uint16_t fgColor, uint16_t bgColor, uint8_t nobg) {
+    int x = run.alignX(box, align);
+    
+    setClip(box.x, box.y, box.w, box.h);
+    beginText(x, box.y, fgColor, bgColor, run.getScale(), nobg);
+    
+    for (uint8_t i = 0; i < run.getCount(); i++) {
+        if (_xchar >= clipX1) break;     // 상자 오른쪽 밖
+        if (_xchar + run.advance(i) <= clipX0) {
+            _xchar += run.advance(i);    // 상자 왼쪽 밖 (오른쪽/가운데 정렬 넘침): 글리프 조회/블릿 생략
+            continue;
+        }
+        draw16Glyph(run.glyph(i));
+    }
+    
+    endText();
+    setClip(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    return x;
+}
+
+// 런타임 문자열 1회 배치 후 정렬 출력
+int RemoteLCD::drawText(const char* str, const lcdtext::TextBox& box, lcdtext::TextAlign align,
+                        uint16_t fgColor, uint16_t bgColor, lcdtext::TextScale scale, uint8_t nobg) {
+    textRun.layout(str, scale);
+    return drawTextRun(textRun, box, align, fgColor, bgColor, nobg);
+}
+
+int RemoteLCD::drawText(lcdtext::TextView text, const lcdtext::TextBox& box, lcdtext::TextAlign align,
+                        uint16_t fgColor, uint16_t bgColor, lcdtext::TextScale scale, uint8_t nobg) {
+    textRun.layout(text, scale);
+    return drawTextRun(textRun, box, align, fgColor, bgColor, nobg);
+}
+
+// 통합 텍스트 출력 (x 는 style.align 에 따라 왼쪽 끝 / 가운데 / 오른쪽 끝)
+int RemoteLCD::drawString(const char* text, int16_t x, int16_t y, const TextStyle& style) {
+    if (!tft || !text) return 0;
+    
+    textRun.layout(text, style.size);
+    int width = textRun.getWidth();
+    if (style.align == lcdtext::ALIGN_CENTER) x -= width / 2;
+    else if (style.align == lcdtext::ALIGN_RIGHT) x -= width;
+    
+    lcdtext::TextBox box = { x, y, (int16_t)width, (int16_t)textRun.getHeight() };
+    drawTextRun(textRun, box, lcdtext::ALIGN_LEFT, style.color, style.bgColor, style.background ? 0 : 1);
+    return width;
+}
+
+void RemoteLCD::beginText(int x, int y, uint16_t fgColor, uint16_t bgColor, lcdtext::TextScale scale, uint8_t nobg) {
     _xchar = x;
     _ychar = y;
     fg_color = fgColor;
     bg_color = bgColor;
     _nobg = nobg;
-    _times = timesX;
+    _scaleQ8 = scale.q8;
+    lastTextStats.transactions = 0;
+    lastTextStats.bytes = 0;
+}
 
-    while (*str) {
-        uint8_t ch1 = *str++;
-        if (ch1 < 0x80) {  // ASCII
-            draw16English(ch1);
-            length += (8 * _times);
-        }
-        else {  // UTF-8 한글 (3바이트)
-            uint8_t ch2 = *str++;
-            uint8_t ch3 = *str++;
-            uint16_t hangeul = (ch1 & 0x0F) << 12 | (ch2 & 0x3F) << 6 | (ch3 & 0x3F);
-            draw16Korean(hangeul);
-            length += (16 * _times);
-        }
-    }
-    return length;
+void RemoteLCD::endText() {
+    totalTextStats.transactions += lastTextStats.transactions;
+    totalTextStats.bytes += lastTextStats.bytes;
+}
+
+// 글자 출력 영역 (화면과 교집합)
+void RemoteLCD::setClip(int x, int y, int w, int h) {
+    clipX0 = x < 0 ? 0 : x;
+    clipY0 = y < 0 ? 0 : y;
+    clipX1 = x + w > SCREEN_WIDTH ? SCREEN_WIDTH : x + w;
+    clipY1 = y + h > SCREEN_HEIGHT ? SCREEN_HEIGHT : y + h;
 }
 
 // 문자열 픽셀 길이 계산
-int RemoteLCD::draw16Length(const char* str, uint8_t timesX) {
+int RemoteLCD::draw16Length(const char* str, lcdtext::TextScale scale) {
     int length = 0;
     while (*str) {
-        uint8_t ch1 = *str++;
-        if (ch1 < 0x80) {  // ASCII
-            length += (8 * timesX);
-        }
-        else {  // UTF-8 한글 (3바이트)
-            str++;  // ch2
-            str++;  // ch3
-            length += (16 * timesX);
-        }
+        uint32_t code = 0;
+        str += lcdtext::decodeUtf8(str, code);
+        length += scale.apply(lcdtext::makeGlyph(code).advance);
     }
     return length;
 }
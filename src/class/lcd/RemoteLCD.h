@@ -4,6 +4,46 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
 #include <SPI.h>
+#include "HangulGlyphCache.h"
+#include "ScaledGlyphCache.h"
+#include "FontPartition.h"
+#include "StaticText.h"
+#include "TextLayout.h"
+#include "LcdWidget.h"
+#include "LcdProgressBar.h"
+#include "LcdTrendChart.h"
+#include "LcdScrollRegion.h"
+#include "LcdMenu.h"
+#include "DiagConsole.h"
+#include "LcdPageLayout.h"
+#include "LcdPageCache.h"
+#include "GlyphKernel.h"
+#include "BigDigitFont.h"
+#include "LcdFrameBuffer.h"
+#include "LcdIndexedFrameBuffer.h"
+#include "LcdDmaFlusher.h"
+
+// 프레임버퍼 모드 (platformio.ini build_flags 의 -DLCD_FRAMEBUFFER_MODE=n 으로 선택)
+//   LCD_FB_NONE   : 패널에 직접 그리기
+//   LCD_FB_RGB565   : PSRAM 전체 화면 RGB565 (150KB), 변경 영역만 전송
+//   LCD_FB_INDEXED4 : 내부 RAM 4bpp 16색 팔레트 (37.5KB), 전송 시 RGB565 변환
+#define LCD_FB_NONE     0
+#define LCD_FB_RGB565   1
+#define LCD_FB_INDEXED4 2
+
+#ifndef LCD_FRAMEBUFFER_MODE
+#ifdef BOARD_HAS_PSRAM
+#define LCD_FRAMEBUFFER_MODE LCD_FB_RGB565
+#else
+#define LCD_FRAMEBUFFER_MODE LCD_FB_NONE
+#endif
+#endif
+
+// 프레임버퍼 전송을 DMA 전용 태스크로 (-DLCD_ASYNC_FLUSH=0 이면 loop()에서 직접 전송)
+// 직접 그리기 모드에서는 사용하지 않음
+#ifndef LCD_ASYNC_FLUSH
+#define LCD_ASYNC_FLUSH 1
+#endif
 
 class RemoteLCD {
 public:
@@ -14,18 +54,55 @@ public:
     
     // 화면 제어
     void clear();
+    void fillRect16(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
     void setBrightness(uint8_t brightness);
     void displayOn();
     void displayOff();
     
-    // 텍스트 출력
-    void printText(const char* text, uint16_t x, uint16_t y, uint16_t color = 0xFFFF);
-    void printTextCentered(const char* text, uint16_t y, uint16_t color = 0xFFFF);
-    void setTextSize(uint8_t size);
+    // 텍스트 출력 (모든 화면 공통)
+    // 모든 문자열은 16x16 렌더러(글리프 캐시)로 그림 (속도 큰 숫자는 showVehicleSpeed 의 BigDigitFont)
+    struct TextStyle {
+        uint16_t color = 0xFFFF;
+        lcdtext::TextScale size = 1;                    // 16x16 기준 배율 (1 = 16픽셀 높이)
+        lcdtext::TextAlign align = lcdtext::ALIGN_LEFT; // x 기준: 왼쪽 끝 / 가운데 / 오른쪽 끝
+        bool background = false;                        // true 면 글자 칸을 bgColor 로 채움
+        uint16_t bgColor = 0x0000;
+    };
+    // 반환: 그린 폭 (픽셀)
+    int drawString(const char* text, int16_t x, int16_t y, const TextStyle& style);
     
     // 한글 지원 (16x16 조합형 폰트)
-    int draw16String(int x, int y, uint16_t fgColor, uint16_t bgColor, const char* str, uint8_t timesX = 1, uint8_t nobg = 0);
-    int draw16Length(const char* str, uint8_t timesX = 1);
+    // scale: 정수 또는 소수 배율 (1.5, 0.6 등, 8.8 고정소수점으로 변환)
+    int draw16String(int x, int y, uint16_t fgColor, uint16_t bgColor, const char* str, lcdtext::TextScale scale = 1, uint8_t nobg = 0);
+    int draw16Length(const char* str, lcdtext::TextScale scale = 1);
+    
+    // 컴파일 타임 문자열 (LCD_TEXT) 출력 - 디코딩/폭 계산 없음
+    int draw16Text(int x, int y, uint16_t fgColor, uint16_t bgColor, lcdtext::TextView text, lcdtext::TextScale scale = 1, uint8_t nobg = 0);
+    static int draw16Length(lcdtext::TextView text, lcdtext::TextScale scale = 1) { return lcdtext::scaledWidth(text, scale); }
+    
+    // 배치 1회 → 상자 안 정렬 출력 (상자 밖은 잘림, 줄바꿈 없음), 반환: 시작 x
+    // 같은 문자열을 여러 번 그리면 TextRun 을 보관해 drawTextRun 으로 재사용
+    int drawTextRun(const lcdtext::TextRun& run, const lcdtext::TextBox& box, lcdtext::TextAlign align,
+                    uint16_t fgColor, uint16_t bgColor, uint8_t nobg = 0);
+    int drawText(const char* str, const lcdtext::TextBox& box, lcdtext::TextAlign align,
+                 uint16_t fgColor, uint16_t bgColor, lcdtext::TextScale scale = 1, uint8_t nobg = 0);
+    int drawText(lcdtext::TextView text, const lcdtext::TextBox& box, lcdtext::TextAlign align,
+                 uint16_t fgColor, uint16_t bgColor, lcdtext::TextScale scale = 1, uint8_t nobg = 0);
+    
+    // SPI 전송 통계 (draw16String 호출 단위)
+    struct SpiStats {
+        uint32_t transactions;  // startWrite ~ endWrite 묶음 수
+        uint32_t bytes;         // 주소창 명령 + 픽셀 데이터 바이트 수
+    };
+    const SpiStats& getLastTextStats() const { return lastTextStats; }
+    const SpiStats& getTotalTextStats() const { return totalTextStats; }
+    void resetTextStats();
+    
+    // 한글 글리프 캐시 (조합 결과 재사용)
+    bool setGlyphCacheCapacity(uint8_t capacity) { return hangulCache.setCapacity(capacity); }
+    HangulGlyphCache& getGlyphCache() { return hangulCache; }
+    ScaledGlyphCache& getScaledGlyphCache() { return scaledCache; }
+    const FontPartition& getFontPartition() const { return fontPartition; }
     
     // 상태 표시
     void showButtonStatus(uint8_t buttonId, bool pressed);
@@ -41,6 +118,80 @@ public:
     void showMotorCurrent(uint16_t current);
     void showFetTemp(int16_t temp);
     
+    // 추세 그래프 (메인 화면 속도와 온도 사이, 하드웨어 세로 스크롤)
+    // 샘플당 가로 1줄 쓰기 + 스크롤 주소 명령 1회. 메인 화면이 아니거나 컴포지터가 꺼져 있으면 무시
+    void addTrendSample(int16_t motorTemp, int16_t fetTemp, uint16_t current);
+    
+    // 진단 콘솔 화면: printf 출력(teeStdout 후) 최근 줄을 프레임마다 하드웨어 스크롤로 추가
+    // 새 줄 1개 = 글자 줄 1개 그리기 + 스크롤 주소 명령 1회. drawMainScreen() 으로 복귀
+    void showConsole();
+    bool isConsoleShown() const { return currentPage == PAGE_CONSOLE; }
+    DiagConsole& getConsole() { return console; }
+    
+    // 페이지 (화면 단위 전환)
+    // 정적 레이어(라벨/구분선)는 그리기 목록으로 처음 한 번 그려 PSRAM 에 저장하고,
+    // 이후 전환은 저장본 복사 + 동적 값만 다시 그림. PSRAM 이 없으면 목록을 다시 실행
+    enum Page : uint8_t {
+        PAGE_NONE = 0,          // clear() 후 (페이지 없음)
+        PAGE_MAIN,
+        PAGE_CONSOLE,
+        PAGE_SETTINGS,
+        PAGE_SETTINGS_MENU
+    };
+    // 다른 페이지면 정적 레이어를 깔고 true → 호출자가 동적 부분을 그린 뒤 endPage()
+    // 이미 그 페이지면 false (정적 레이어 그대로, 동적 부분만 갱신하면 됨)
+    bool beginPage(Page page, const LcdPageLayout& layout);
+    void endPage();     // 전환 시간 기록/출력 (beginPage 가 true 였을 때만)
+    Page getPage() const { return currentPage; }
+    
+    struct PageStats {
+        uint32_t switches;      // 페이지 전환 수
+        uint32_t cached;        // 그중 저장본으로 복원한 수
+        uint32_t lastUs;        // 마지막 전환 시간 (CPU 쪽, DMA 전송 제외)
+        uint32_t worstUs;
+    };
+    const PageStats& getPageStats() const { return pageStats; }
+    
+    // 메인 화면 머리 줄에 잠깐 표시 (기다리지 않음), durationMs 후 update() 에서 배경 복원
+    void showToast(const char* text, uint16_t color, uint16_t durationMs);
+    
+    // 목록 메뉴 (현재 페이지의 menu 영역): 선택이 바뀐 줄만 다시 그림
+    // 한 화면보다 길면 하드웨어 스크롤 - 새로 들어온 줄만 그리고 시작 주소 이동
+    // 페이지에 새로 들어왔으면 menu.invalidate() (또는 setItems) 후 호출
+    void drawMenu(LcdMenu& menu, uint8_t selected);
+    
+    // 위젯 다시 그리기 통계 (값이 같아 생략된 횟수 / 실제 그린 횟수)
+    struct WidgetStats {
+        uint32_t redraws;
+        uint32_t skipped;
+    };
+    const WidgetStats& getWidgetStats() const { return widgetStats; }
+    void invalidateWidgets();
+    
+    // UI 컴포지터: show*() 는 값만 기록하고 update() 에서 프레임 주기로 그림
+    // fps = 0 이면 호출 즉시 그림 (기존 동작, 호출하는 태스크가 하나일 때만 - 추세 그래프 샘플은 버림)
+    void setFrameRate(uint8_t fps);
+    void update();  // loop()에서 호출
+    
+    // 즉시 반영: 대기 중인 위젯 값 그리기 + 프레임버퍼 변경 영역 전송
+    void flush();
+    LcdCanvas* getCanvas() { return canvas; }
+    LcdDmaFlusher* getDmaFlusher() { return dma; }     // nullptr = 동기 전송
+    
+    // 패널 명령 (DMA 태스크 사용 시 전송 큐로, 아니면 즉시), 큐가 차 있으면 false
+    bool sendCommand(uint8_t cmd, const uint8_t* data, uint8_t len);
+    void printFrameBufferStats();  // 버퍼 RAM 사용량 + 전송 비용 출력
+    
+    struct FrameStats {
+        uint32_t frames;            // 그린 프레임 수
+        uint32_t dropped;           // 늦게 호출되어 건너뛴 프레임 수
+        uint32_t coalesced;         // 프레임 전에 덮어써진 갱신 수
+        uint32_t lastFrameUs;       // 마지막 프레임 그리기 시간
+        uint32_t worstFrameUs;      // 최악 프레임 그리기 시간
+    };
+    const FrameStats& getFrameStats() const { return frameStats; }
+    void resetFrameStats();
+    
     // UI 그리기
     void drawMainScreen();
     void drawButton(uint16_t x, uint16_t y, uint16_t w, uint16_t h, 
@@ -61,23 +212,161 @@ public:
         GRAY = 0x8410
     };
     
+    // 화면 크기 (세로형)
+    static const uint16_t SCREEN_WIDTH  = 240;
+    static const uint16_t SCREEN_HEIGHT = 320;
+    
 private:
     Adafruit_ST7789* tft;
-    uint8_t currentTextSize;
+    LcdCanvas* canvas;      // 프레임버퍼 (nullptr = 직접 그리기)
+    LcdDmaFlusher* dma;     // 비동기 전송 (nullptr = flush 가 직접 전송)
+    Adafruit_GFX* gfx;      // 그리기 대상 (canvas 또는 tft)
     
     // 한글 폰트 렌더링 변수
     int _xchar;
     int _ychar;
     uint8_t _nobg;
-    uint8_t _times;
+    uint8_t _times;         // 블릿 정수 배율
+    uint16_t _scaleQ8;      // 요청 배율 (8.8 고정소수점)
+    int16_t clipX0, clipY0, clipX1, clipY1;    // 글자 출력 영역 (끝 좌표 미포함)
+    lcdtext::TextRun textRun;                  // drawText 배치 버퍼
     uint16_t fg_color;
     uint16_t bg_color;
     
+    // SPI 통계
+    SpiStats lastTextStats;
+    SpiStats totalTextStats;
+    
+    // 대시보드 위젯 (마지막 표시 값)
+    static const uint8_t SPEED_DIGITS = 3;    // 0~255
+    LcdWidget<uint8_t> speedWidget;           // 큰 숫자 칸 SPEED_DIGITS 개 (오른쪽 정렬)
+    char speedShown[SPEED_DIGITS];            // 칸별 표시 중인 글자 (' ' = 빈칸, 0 = 무효)
+    LcdWidget<uint8_t> directionWidget;
+    LcdWidget<int16_t> motorTempWidget;
+    LcdWidget<int16_t> fetTempWidget;
+    LcdWidget<uint16_t> currentWidget;     // 0.1A 단위 (표시 해상도)
+    LcdWidget<uint8_t> batteryWidget;
+    LcdProgressBar batteryBar;             // 마지막 채움 폭 기억 (변경 띠만 그림)
+    LcdWidget<LcdTrendChart::Sample> trendWidget;   // 컴포지터 대기 샘플
+    LcdTrendChart trendChart;
+    
+    // 페이지
+    LcdPageCache pageCache;
+    Page currentPage;
+    const LcdPageLayout* currentLayout;    // 현재 페이지 그리기 목록 (배경 복원용)
+    bool pageSwitching;                    // beginPage ~ endPage
+    bool pageFromCache;
+    unsigned long pageStartUs;
+    PageStats pageStats;
+    unsigned long toastUntil;              // 0 = 표시 중 아님 (millis)
+    static const int16_t TOAST_Y = 40;
+    
+    // 진단 콘솔
+    DiagConsole console;
+    LcdScrollRegion consoleScroll;         // 16줄 칸 단위
+    uint32_t consoleNext;                  // 다음에 그릴 줄 번호
+    
+    // 하드웨어 스크롤 (한 번에 한 영역)
+    const LcdScrollRegion* activeScroll;   // nullptr = 스크롤 없음 (패널 메모리 줄 = 화면 줄)
+    bool scrollPending;                    // 줄 전송 후 보낼 VSCSAD 대기
+    uint16_t pendingScrollAddress;
+    LcdWidget<int8_t> rssiWidget;
+    LcdWidget<bool> linkWidget;
+    WidgetStats widgetStats;
+    
+    // 컴포지터
+    uint32_t framePeriodUs;         // 0 = 즉시 그리기
+    unsigned long lastFrameTime;
+    FrameStats frameStats;
+    portMUX_TYPE widgetLock;        // 대기 값 보호 (ESP-NOW 수신 태스크 ↔ loop)
+    
+    void flushWidgets();
+    void restoreWidgets();
+    void drawLayout(const LcdPageLayout& layout);
+    void drawLayoutItem(const LcdPageItem& item);
+    void restoreBackground(int16_t x, int16_t y, int16_t w, int16_t h);
+    void endScroll();
+    void drawConnectionStatus(bool connected);
+    void drawBatteryLevel(uint8_t percentage);
+    void drawRSSI(int8_t rssi);
+    void drawVehicleSpeed(uint8_t speed);
+    void drawVehicleDirection(uint8_t direction);
+    void drawMotorTemp(int16_t temp);
+    void drawMotorCurrent(uint16_t current);
+    void drawFetTemp(int16_t temp);
+    void drawSpeedDigits(uint8_t speed);
+    void beginTrendChart();
+    void drawTrendRow(const LcdTrendChart::Sample& sample);
+    void writeChartRow(int16_t y);
+    void drawConsoleLines();
+    void drawMenuRow(const LcdMenu& menu, uint8_t index);
+    void beginScroll(const LcdScrollRegion& region);
+    void requestScroll(uint16_t address);
+    void flushScroll();
+    LcdCanvas* createIndexedCanvas();
+    
+    // 컴포지터 사용 중이면 대기 값으로 기록하고 true (지금 그리지 않음)
+    template <typename T>
+    bool queueWidget(LcdWidget<T>& widget, const T& value) {
+        if (framePeriodUs == 0) return false;
+        portENTER_CRITICAL(&widgetLock);
+        if (widget.post(value)) frameStats.coalesced++;
+        portEXIT_CRITICAL(&widgetLock);
+        return true;
+    }
+    
+    template <typename T>
+    bool takeWidget(LcdWidget<T>& widget, T& value) {
+        portENTER_CRITICAL(&widgetLock);
+        bool has = widget.take(value);
+        portEXIT_CRITICAL(&widgetLock);
+        return has;
+    }
+    
+    // 위젯 영역 = 글자 출력 상자
+    template <typename T>
+    static lcdtext::TextBox widgetBox(const LcdWidget<T>& widget) {
+        return { widget.x, widget.y, (int16_t)widget.w, (int16_t)widget.h };
+    }
+    
+    // 값이 바뀌었으면 기록 후 true, 아니면 생략 집계 후 false
+    template <typename T>
+    bool updateWidget(LcdWidget<T>& widget, const T& value) {
+        if (!widget.isChanged(value)) {
+            widgetStats.skipped++;
+            return false;
+        }
+        widgetStats.redraws++;
+        widget.commit(value);
+        return true;
+    }
+    
+    // 조합 한글 글리프 캐시
+    HangulGlyphCache hangulCache;
+    
+    // 비정수 배율 글리프 캐시 (리샘플 결과)
+    ScaledGlyphCache scaledCache;
+    
+    // 플래시 폰트 파티션 (매핑 실패 시 isLoaded() == false)
+    FontPartition fontPartition;
+    
+    // 글리프 1줄 확장 버퍼 (RGB565, 화면 폭)
+    alignas(4) uint16_t lineBuffer[240];    // GlyphKernel 워드 저장
+    
     // 한글 폰트 내부 함수
     void draw16English(uint8_t ch);
-    void draw16Korean(uint16_t hangeul);
-    void setPixel(uint16_t x, uint16_t y, uint16_t color);
-    void fillRect16(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void draw16Korean(const lcdtext::TextGlyph& glyph);
+    void draw16Symbol(const lcdtext::TextGlyph& glyph);
+    void beginText(int x, int y, uint16_t fgColor, uint16_t bgColor, lcdtext::TextScale scale, uint8_t nobg);
+    void endText();
+    void setClip(int x, int y, int w, int h);
+    void draw16Glyph(const lcdtext::TextGlyph& glyph);
+    static void composeHangul(const uint16_t* part, uint8_t* glyph);
+    void drawScaledGlyph(uint16_t code, const uint8_t* bits, uint8_t width, uint8_t stride);
+    void blitGlyph(const uint8_t* bits, uint8_t width, uint8_t height, uint8_t stride);
+    
+    // CASET(1+4) + RASET(1+4) + RAMWR(1)
+    static const uint8_t ADDR_WINDOW_BYTES = 11;
     
     // 핀 정의
     static const uint8_t TFT_CS   = 5;
@@ -85,10 +374,6 @@ private:
     static const uint8_t TFT_RST  = 15;
     static const uint8_t TFT_MOSI = 23;
     static const uint8_t TFT_SCLK = 18;
-    
-    // 화면 크기 (세로형)
-    static const uint16_t SCREEN_WIDTH  = 240;
-    static const uint16_t SCREEN_HEIGHT = 320;
 };
 
 #endif // REMOTE_LCD_H
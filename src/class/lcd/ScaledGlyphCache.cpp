@@ -0,0 +1,65 @@
+#include "ScaledGlyphCache.h"
+
+ScaledGlyphCache::ScaledGlyphCache(uint8_t capacity) {
+    sizes = nullptr;
+    bitmaps = nullptr;
+    
+    setCapacity(capacity);
+}
+
+ScaledGlyphCache::~ScaledGlyphCache() {
+    release();
+}
+
+void ScaledGlyphCache::release() {
+    slots.release();
+    delete[] sizes;
+    delete[] bitmaps;
+    sizes = nullptr;
+    bitmaps = nullptr;
+}
+
+bool ScaledGlyphCache::setCapacity(uint8_t newCapacity) {
+    release();
+    
+    if (newCapacity == 0) {
+        return true;  // 캐시 사용 안 함
+    }
+    
+    sizes = new uint8_t[newCapacity * 2];
+    bitmaps = new uint8_t[newCapacity][GLYPH_BYTES];
+    
+    if (!sizes || !bitmaps || !slots.allocate(newCapacity)) {
+        release();
+        return false;
+    }
+    
+    return true;
+}
+
+void ScaledGlyphCache::fill(uint8_t slot, Entry& entry) {
+    entry.width = sizes[slot * 2];
+    entry.height = sizes[slot * 2 + 1];
+    entry.stride = (entry.width + 7) >> 3;
+    entry.bits = bitmaps[slot];
+}
+
+bool ScaledGlyphCache::find(uint16_t code, uint16_t scaleQ8, Entry& entry) {
+    int16_t slot = slots.find(((uint32_t)code << 16) | scaleQ8);
+    if (slot == slots.NOT_FOUND) return false;
+    
+    fill(slot, entry);
+    return true;
+}
+
+bool ScaledGlyphCache::insert(uint16_t code, uint16_t scaleQ8, uint8_t width, uint8_t height, Entry& entry) {
+    if (width > MAX_DIM || height > MAX_DIM) return false;
+    
+    int16_t slot = slots.claim(((uint32_t)code << 16) | scaleQ8);
+    if (slot == slots.NOT_FOUND) return false;
+    
+    sizes[slot * 2] = width;
+    sizes[slot * 2 + 1] = height;
+    fill(slot, entry);
+    return true;
+}
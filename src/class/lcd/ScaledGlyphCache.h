@@ -0,0 +1,54 @@
+#ifndef SCALED_GLYPH_CACHE_H
+#define SCALED_GLYPH_CACHE_H
+
+#include <stdint.h>
+#include "LruSlots.h"
+
+// 비정수 배율 글리프 LRU 캐시
+// - 키: (코드포인트, 8.8 배율)
+// - 값: 리샘플된 1bpp 비트맵 (줄 간격 = (폭+7)/8 바이트, MSB=왼쪽)
+// 1.5배, 0.6배 같은 글자를 처음 그릴 때 한 번만 리샘플하고
+// 이후에는 1배 글리프처럼 그대로 블릿한다.
+class ScaledGlyphCache {
+public:
+    static const uint8_t MAX_DIM = 48;                                  // 16x16 기준 3배까지
+    static const uint16_t GLYPH_BYTES = ((MAX_DIM + 7) / 8) * MAX_DIM;  // 288
+    static const uint8_t DEFAULT_CAPACITY = 24;
+    
+    struct Entry {
+        uint8_t width;
+        uint8_t height;
+        uint8_t stride;
+        uint8_t* bits;
+    };
+    
+    ScaledGlyphCache(uint8_t capacity = DEFAULT_CAPACITY);
+    ~ScaledGlyphCache();
+    
+    // 용량 변경 (기존 항목은 모두 삭제)
+    bool setCapacity(uint8_t capacity);
+    uint8_t getCapacity() const { return slots.getCapacity(); }
+    
+    // 조회: 있으면 true + entry (히트/미스 집계)
+    bool find(uint16_t code, uint16_t scaleQ8, Entry& entry);
+    
+    // 삽입: 가장 오래 사용하지 않은 슬롯을 비워 반환 (호출자가 bits 채움)
+    bool insert(uint16_t code, uint16_t scaleQ8, uint8_t width, uint8_t height, Entry& entry);
+    
+    void clear() { slots.clear(); }
+    
+    // 통계
+    uint32_t getHits() const { return slots.getHits(); }
+    uint32_t getMisses() const { return slots.getMisses(); }
+    void resetStats() { slots.resetStats(); }
+
+private:
+    LruSlots<uint32_t> slots;           // 키 = (code << 16) | scaleQ8
+    uint8_t* sizes;                     // [폭, 높이] 쌍
+    uint8_t (*bitmaps)[GLYPH_BYTES];
+    
+    void release();
+    void fill(uint8_t slot, Entry& entry);
+};
+
+#endif // SCALED_GLYPH_CACHE_H
@@ -0,0 +1,172 @@
+#ifndef STATIC_TEXT_H
+#define STATIC_TEXT_H
+
+#include <stdint.h>
+
+// 16x16 폰트용 텍스트 디코딩 (UTF-8 → 글리프)
+// 모든 함수가 constexpr 이므로 LCD_TEXT("...") 로 만든 문자열은
+// 컴파일 시점에 디코딩/한글 분해/픽셀 폭 계산이 끝난 상태로 플래시에 들어간다.
+// 런타임 문자열(draw16String)도 같은 함수로 디코딩한다.
+namespace lcdtext {
+
+// 중성에 따른 초성/종성 벌 선택 테이블
+constexpr uint8_t CHO_TYPE_NO_JONG[22] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 3, 3, 1, 2, 4, 4, 4, 2, 1, 3, 0 };
+constexpr uint8_t CHO_TYPE_JONG[22]    = { 0, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 6, 6, 7, 7, 7, 6, 6, 7, 5 };
+constexpr uint8_t JONG_TYPE[22]        = { 0, 0, 2, 0, 2, 1, 2, 1, 2, 3, 0, 2, 1, 3, 3, 1, 2, 1, 3, 3, 1, 1 };
+
+constexpr uint16_t HANGUL_FIRST = 0xAC00;  // '가'
+constexpr uint16_t HANGUL_LAST  = 0xD7A3;  // '힣'
+
+// 디코딩된 글리프 1개
+struct TextGlyph {
+    uint16_t code;      // 코드포인트 (ASCII 포함)
+    uint16_t part[3];   // 영문: english 인덱스 / 한글: K_font 초·중·종성 인덱스 (0 = 빈 글리프) / 기호: 없음
+    uint8_t advance;    // 1배 기준 가로 폭 (U+00FF 까지 8, 그 외 16)
+};
+
+// 글리프 배열 참조 (StaticText / 런타임 버퍼 공용)
+struct TextView {
+    const TextGlyph* glyphs;
+    uint8_t count;
+    uint16_t width;     // 1배 기준 전체 픽셀 폭
+};
+
+// 글자 배율 (8.8 고정소수점, 256 = 1배)
+// 정수/실수 리터럴 모두 받음: draw16Text(..., 2), draw16Text(..., 1.5)
+struct TextScale {
+    uint16_t q8;
+    
+    constexpr TextScale(int times) : q8((uint16_t)(times << 8)) {}
+    constexpr TextScale(double times) : q8((uint16_t)(times * 256 + 0.5)) {}
+    
+    constexpr bool isInteger() const { return (q8 & 0xFF) == 0; }
+    constexpr uint8_t integer() const { return q8 >> 8; }
+    
+    // 1배 기준 픽셀 → 배율 적용 픽셀 (글리프 단위 반올림)
+    constexpr int apply(int px) const { return (px * q8 + 128) >> 8; }
+};
+
+// 배율 적용 전체 폭 (글리프마다 반올림한 폭의 합 = 실제 그려지는 폭)
+constexpr int scaledWidth(TextView text, TextScale scale) {
+    if (scale.isInteger()) return text.width * scale.integer();
+    
+    int width = 0;
+    for (uint8_t i = 0; i < text.count; i++) {
+        width += scale.apply(text.glyphs[i].advance);
+    }
+    return width;
+}
+
+// UTF-8 한 글자 디코딩, 소비한 바이트 수 반환 (잘못된 시퀀스는 1바이트 소비, U+FFFD)
+constexpr uint8_t decodeUtf8(const char* s, uint32_t& code) {
+    uint8_t lead = (uint8_t)s[0];
+    uint8_t len = 1;
+    
+    if (lead < 0x80) {
+        code = lead;
+        return 1;
+    }
+    else if ((lead & 0xE0) == 0xC0) { len = 2; code = lead & 0x1F; }
+    else if ((lead & 0xF0) == 0xE0) { len = 3; code = lead & 0x0F; }
+    else if ((lead & 0xF8) == 0xF0) { len = 4; code = lead & 0x07; }
+    else {
+        code = 0xFFFD;
+        return 1;
+    }
+    
+    for (uint8_t i = 1; i < len; i++) {
+        uint8_t next = (uint8_t)s[i];
+        if ((next & 0xC0) != 0x80) {  // 중간에 잘린 시퀀스 (NUL 포함)
+            code = 0xFFFD;
+            return i;
+        }
+        code = (code << 6) | (next & 0x3F);
+    }
+    return len;
+}
+
+// 한글 음절 → K_font 초·중·종성 인덱스
+constexpr void hangulParts(uint16_t hangeul, uint16_t* part) {
+    uint16_t index = hangeul - HANGUL_FIRST;
+    uint8_t last = index % 28;  // 종성
+    index /= 28;
+    uint8_t first = index / 21 + 1;  // 초성
+    uint8_t mid = index % 21 + 1;    // 중성
+    
+    uint8_t firstType = 0, midType = 0, lastType = 0;
+    if (last == 0) {  // 받침 없는 경우
+        firstType = CHO_TYPE_NO_JONG[mid];
+        midType = (first == 1 || first == 24) ? 0 : 1;
+    }
+    else {  // 받침 있는 경우
+        firstType = CHO_TYPE_JONG[mid];
+        midType = (first == 1 || first == 24) ? 2 : 3;
+        lastType = JONG_TYPE[mid];
+    }
+    
+    part[0] = firstType * 20 + first;                   // 초성(0~159)
+    part[1] = 160 + midType * 22 + mid;                 // 중성(160~247)
+    part[2] = last ? 248 + lastType * 28 + last : 0;    // 종성(248~359)
+}
+
+// 코드포인트 → 글리프
+constexpr TextGlyph makeGlyph(uint32_t code) {
+    TextGlyph g = { 0, { 0, 0, 0 }, 16 };
+    if (code < 0x80) {
+        g.code = code;
+        g.part[0] = code;
+        g.advance = 8;
+    }
+    else if (code >= HANGUL_FIRST && code <= HANGUL_LAST) {
+        g.code = code;
+        hangulParts(code, g.part);
+    }
+    else {
+        // 기호/Latin-1: 폰트 파티션에서 찾고 없으면 대체 글리프 (FontPartition)
+        // 폭은 파티션 생성기(tools/build_font_partition.py)와 같은 규칙
+        g.code = code > 0xFFFF ? 0xFFFD : code;
+        g.advance = code < 0x100 ? 8 : 16;
+    }
+    return g;
+}
+
+// 문자열의 글리프 개수
+constexpr uint8_t glyphCount(const char* s) {
+    uint8_t count = 0;
+    while (*s) {
+        uint32_t code = 0;
+        s += decodeUtf8(s, code);
+        count++;
+    }
+    return count;
+}
+
+// 컴파일 타임 문자열 (N = 글리프 개수)
+template <uint8_t N>
+struct StaticText {
+    TextGlyph glyphs[N > 0 ? N : 1] = {};
+    uint16_t width = 0;
+    
+    constexpr TextView view() const { return TextView{ glyphs, N, width }; }
+    constexpr operator TextView() const { return view(); }
+};
+
+template <uint8_t N>
+constexpr StaticText<N> make(const char* s) {
+    StaticText<N> text;
+    for (uint8_t i = 0; i < N; i++) {
+        uint32_t code = 0;
+        s += decodeUtf8(s, code);
+        text.glyphs[i] = makeGlyph(code);
+        text.width += text.glyphs[i].advance;
+    }
+    return text;
+}
+
+} // namespace lcdtext
+
+// 문자열 리터럴 → 컴파일 타임 글리프 배열
+// 예) static constexpr auto TITLE = LCD_TEXT("YCB AI 전동차");
+#define LCD_TEXT(str) (lcdtext::make<lcdtext::glyphCount(str)>(str))
+
+#endif // STATIC_TEXT_H
@@ -0,0 +1,48 @@
+#include "TextLayout.h"
+
+namespace lcdtext {
+
+uint8_t TextRun::layout(const char* str, TextScale newScale) {
+    count = 0;
+    glyphs = buffer;
+    
+    while (*str && count < MAX_GLYPHS) {
+        uint32_t code = 0;
+        str += decodeUtf8(str, code);
+        buffer[count++] = makeGlyph(code);
+    }
+    
+    measure(newScale);
+    return count;
+}
+
+uint8_t TextRun::layout(TextView text, TextScale newScale) {
+    glyphs = text.glyphs;
+    count = text.count < MAX_GLYPHS ? text.count : MAX_GLYPHS;
+    
+    measure(newScale);
+    return count;
+}
+
+void TextRun::measure(TextScale newScale) {
+    scale = newScale;
+    width = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        advances[i] = scale.apply(glyphs[i].advance);
+        width += advances[i];
+    }
+    height = scale.apply(16);
+}
+
+int TextRun::alignX(const TextBox& box, TextAlign align) const {
+    switch (align) {
+        case ALIGN_CENTER:
+            return box.x + (box.w - width) / 2;
+        case ALIGN_RIGHT:
+            return box.x + box.w - width;
+        default:
+            return box.x;
+    }
+}
+
+} // namespace lcdtext
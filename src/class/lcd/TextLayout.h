@@ -0,0 +1,63 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include "StaticText.h"
+
+namespace lcdtext {
+
+// 상자 안 가로 정렬
+enum TextAlign : uint8_t {
+    ALIGN_LEFT,
+    ALIGN_CENTER,
+    ALIGN_RIGHT
+};
+
+// 출력 상자 (글자는 이 안으로 잘리고 줄바꿈하지 않음)
+struct TextBox {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+// 한 번 디코딩한 글리프 열 (글리프 + 배율 적용 전진 폭, 전체 폭/높이)
+// - layout(const char*): UTF-8 을 1회 디코딩해 내부 버퍼에 보관
+// - layout(TextView): LCD_TEXT 글리프를 그대로 참조 (복사/디코딩 없음)
+// 정렬 위치 계산과 출력(RemoteLCD::drawTextRun)이 같은 결과를 재사용한다.
+// 출력은 전진 폭으로 상자 왼쪽 밖 글리프를 그리지 않고 건너뛴다.
+class TextRun {
+public:
+    static const uint8_t MAX_GLYPHS = 40;   // 화면 폭 240 / 최소 8픽셀 + 여유
+    
+    TextRun() : glyphs(buffer), count(0), width(0), height(16), scale(1) {}
+    
+    // 넘치는 글자는 잘림 (반환: 배치한 글리프 수)
+    uint8_t layout(const char* str, TextScale scale = 1);
+    uint8_t layout(TextView text, TextScale scale = 1);
+    
+    uint8_t getCount() const { return count; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    TextScale getScale() const { return scale; }
+    
+    const TextGlyph& glyph(uint8_t i) const { return glyphs[i]; }
+    int16_t advance(uint8_t i) const { return advances[i]; }     // 배율 적용 폭 (3배 16픽셀 = 48)
+    
+    // 상자 안 정렬 시작 x (상자보다 넓으면 넘친 부분은 출력 때 잘림)
+    int alignX(const TextBox& box, TextAlign align) const;
+    
+private:
+    const TextGlyph* glyphs;        // buffer 또는 외부 TextView
+    TextGlyph buffer[MAX_GLYPHS];
+    int16_t advances[MAX_GLYPHS];   // uint8_t 는 255픽셀 넘는 배율에서 넘침
+    uint8_t count;
+    int width;
+    int height;
+    TextScale scale;
+    
+    void measure(TextScale scale);
+};
+
+} // namespace lcdtext
+
+#endif // TEXT_LAYOUT_H
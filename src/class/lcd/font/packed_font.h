@@ -0,0 +1,476 @@
+// 자동 생성 파일 - 직접 수정하지 말 것 (tools/pack_font.py --variant 005)
+// 원본 13568 바이트 → 7609 바이트 (한글 5817 + 영문 1792, 오프셋 표 포함)
+#ifndef PACKED_FONT_DATA_H
+#define PACKED_FONT_DATA_H
+
+#include <stdint.h>
+
+// 한글 자모 360개 (KSX1001_005), 마스크 4바이트
+const uint16_t PACKED_KFONT_OFFSET[360] = {
+  0x0000,0x0004,0x0014,0x002C,0x003D,0x004F,0x0061,0x0078,0x0094,0x00B0,0x00CC,0x00DE,
+  0x00F5,0x010D,0x0120,0x0134,0x0147,0x0157,0x016A,0x017C,0x0191,0x0195,0x01A4,0x01BC,
+  0x01C9,0x01D7,0x01EB,0x01FB,0x020F,0x0223,0x0237,0x0249,0x025B,0x026F,0x0281,0x0293,
+  0x02A7,0x02B7,0x02C7,0x02DB,0x02EF,0x02F3,0x0300,0x0314,0x031F,0x032B,0x033B,0x0349,
+  0x0359,0x0369,0x0379,0x038B,0x039D,0x03AF,0x03C1,0x03D3,0x03E5,0x03F3,0x0401,0x0411,
+  0x0423,0x0427,0x043C,0x044F,0x045C,0x046A,0x0478,0x048B,0x049F,0x04B3,0x04C7,0x04D5,
+  0x04E6,0x04F6,0x0504,0x0515,0x0523,0x0538,0x0548,0x0556,0x0565,0x0569,0x0578,0x0587,
+  0x0591,0x059C,0x05A7,0x05B4,0x05C2,0x05D2,0x05E2,0x05ED,0x05FB,0x0607,0x0613,0x0621,
+  0x062D,0x063C,0x0648,0x0653,0x065F,0x0663,0x066E,0x067E,0x068A,0x0697,0x06A4,0x06B4,
+  0x06C6,0x06D8,0x06EA,0x06F6,0x0704,0x0712,0x071F,0x072E,0x073B,0x0746,0x0754,0x0761,
+  0x076F,0x0773,0x077E,0x078C,0x0796,0x07A1,0x07AF,0x07BB,0x07C9,0x07D7,0x07E5,0x07F3,
+  0x0801,0x080F,0x081D,0x082B,0x0839,0x0845,0x0851,0x085F,0x086F,0x0873,0x0880,0x088D,
+  0x0896,0x08A0,0x08AA,0x08B7,0x08C3,0x08CF,0x08DB,0x08E4,0x08EE,0x08F8,0x0902,0x090D,
+  0x0918,0x0926,0x0931,0x093B,0x0947,0x094B,0x095C,0x096D,0x097E,0x098F,0x09A0,0x09B2,
+  0x09C3,0x09D6,0x09E0,0x09F6,0x0A0C,0x0A22,0x0A30,0x0A3E,0x0A54,0x0A6A,0x0A80,0x0A8E,
+  0x0A94,0x0AA6,0x0AB7,0x0ABB,0x0ACC,0x0ADD,0x0AEE,0x0AFF,0x0B10,0x0B22,0x0B33,0x0B46,
+  0x0B52,0x0B66,0x0B7A,0x0B8E,0x0B9A,0x0BA8,0x0BBE,0x0BD4,0x0BEA,0x0BF8,0x0BFE,0x0C10,
+  0x0C21,0x0C25,0x0C31,0x0C3D,0x0C49,0x0C55,0x0C61,0x0C6E,0x0C7A,0x0C88,0x0C92,0x0CA1,
+  0x0CB0,0x0CBF,0x0CC9,0x0CD3,0x0CE2,0x0CF1,0x0D00,0x0D0A,0x0D10,0x0D1D,0x0D29,0x0D2D,
+  0x0D39,0x0D45,0x0D51,0x0D5D,0x0D69,0x0D76,0x0D82,0x0D90,0x0D9A,0x0DA9,0x0DB8,0x0DC7,
+  0x0DD1,0x0DDB,0x0DEA,0x0DF9,0x0E08,0x0E12,0x0E18,0x0E25,0x0E31,0x0E35,0x0E3F,0x0E4D,
+  0x0E5B,0x0E65,0x0E73,0x0E81,0x0E8C,0x0E98,0x0EA6,0x0EB4,0x0EC2,0x0ED0,0x0EDE,0x0EEC,
+  0x0EFA,0x0F08,0x0F16,0x0F24,0x0F32,0x0F40,0x0F4E,0x0F5C,0x0F6C,0x0F77,0x0F83,0x0F91,
+  0x0FA1,0x0FA5,0x0FAF,0x0FBD,0x0FCB,0x0FD5,0x0FE3,0x0FF1,0x0FFC,0x1008,0x1016,0x1024,
+  0x1032,0x1040,0x104E,0x105C,0x106A,0x1078,0x1086,0x1094,0x10A2,0x10B0,0x10BE,0x10CC,
+  0x10DC,0x10E7,0x10F3,0x1101,0x1111,0x1115,0x111F,0x112D,0x113B,0x1145,0x1153,0x1161,
+  0x116C,0x1178,0x1186,0x1194,0x11A2,0x11B0,0x11BE,0x11CC,0x11DA,0x11E8,0x11F6,0x1204,
+  0x1210,0x121E,0x122C,0x1239,0x1248,0x1253,0x125F,0x126D,0x127D,0x1281,0x128B,0x1299,
+  0x12A7,0x12B1,0x12BF,0x12CD,0x12D8,0x12E4,0x12F2,0x1300,0x130E,0x131C,0x132A,0x1338,
+  0x1346,0x1354,0x1362,0x1370,0x137E,0x138C,0x139A,0x13A8,0x13B6,0x13C1,0x13CD,0x13DB,
+};
+const uint8_t PACKED_KFONT_DATA[5097] = {
+  0x00,0x00,0x00,0x00,0x54,0x55,0x55,0x01,0x7F,0x03,0x03,0x03,0x03,0x03,0x03,0x06,
+  0x06,0x0C,0x18,0x70,0xFC,0xFF,0x57,0x01,0x7F,0x80,0x0D,0x80,0x0D,0x80,0x0D,0x80,
+  0x0D,0x80,0x0D,0x80,0x0D,0x80,0x0D,0x80,0x1B,0x1B,0x36,0x6C,0x54,0x55,0x55,0x03,
+  0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x7F,0x80,0x5C,0x55,0x55,
+  0x03,0x7F,0x80,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x7F,0x80,0x5C,
+  0x55,0x55,0x03,0x7F,0x80,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x66,0x7F,
+  0x80,0xFC,0x7F,0x55,0x03,0x7F,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x7F,
+  0x80,0x60,0x60,0x60,0x60,0x60,0x7F,0x80,0xFC,0xFF,0xFF,0x03,0x7F,0x80,0x61,0x80,
+  0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,
+  0x61,0x80,0x7F,0x80,0xFC,0xFF,0xFF,0x03,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,
+  0x61,0x80,0x7F,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x7F,0x80,
+  0xFC,0xFF,0xFF,0x03,0x6D,0x80,0x6D,0x80,0x6D,0x80,0x6D,0x80,0x6D,0x80,0x7F,0x80,
+  0x6D,0x80,0x6D,0x80,0x6D,0x80,0x6D,0x80,0x6D,0x80,0x7F,0x80,0x54,0x55,0xD5,0x03,
+  0x0C,0x0C,0x0C,0x0C,0x1E,0x1E,0x1E,0x33,0x33,0x33,0x61,0x80,0x61,0x80,0x54,0xF5,
+  0xFF,0x03,0x1B,0x1B,0x1B,0x1B,0x1B,0x3F,0x80,0x3F,0x80,0x37,0x80,0x37,0x80,0x6C,
+  0xC0,0x6C,0xC0,0x6C,0xC0,0xD4,0xFF,0x7F,0x01,0x1E,0x33,0x61,0x80,0x61,0x80,0x61,
+  0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x33,0x1E,0x5C,0x55,0xD5,
+  0x03,0x7F,0x80,0x0C,0x0C,0x0C,0x1E,0x1E,0x1E,0x33,0x33,0x33,0x61,0x80,0x61,0x80,
+  0x5C,0x55,0xF5,0x03,0xFF,0x80,0x36,0x36,0x36,0x36,0x7F,0x7F,0x6F,0x6F,0xD9,0x80,
+  0xD9,0x80,0xD9,0x80,0x74,0x55,0xD5,0x03,0x0C,0x7F,0x80,0x0C,0x0C,0x0C,0x1E,0x1E,
+  0x1E,0x33,0x33,0x61,0x80,0x61,0x80,0x54,0x55,0x55,0x01,0x7F,0x03,0x03,0x03,0x03,
+  0x7F,0x03,0x06,0x06,0x0C,0x18,0x70,0x5C,0x75,0x55,0x03,0x7F,0x80,0x60,0x60,0x60,
+  0x60,0x7F,0x80,0x60,0x60,0x60,0x60,0x60,0x7F,0x80,0x5C,0x55,0x55,0x03,0x7F,0x80,
+  0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x7F,0x80,0x34,0xF5,0x7F,0x01,
+  0x0C,0x7F,0x80,0x1E,0x33,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x33,
+  0x1E,0x00,0x00,0x00,0x00,0xAC,0xAA,0x2A,0x00,0x3F,0xFC,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0x0C,0x0C,0x0C,0x18,0xFC,0xFF,0x3F,0x00,0x3F,0xFC,0x03,0x0C,0x03,0x0C,0x03,0x0C,
+  0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x06,0x18,0x54,0x55,0x03,0x00,
+  0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x3F,0xFC,0x5C,0x55,0x03,0x00,0x3F,0xFC,0x30,
+  0x30,0x30,0x30,0x30,0x30,0x3F,0xFC,0xFC,0xFF,0x03,0x00,0x3F,0xFC,0x30,0xC0,0x30,
+  0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x3F,0xFC,0xAC,0x5E,0x0D,0x00,0x3F,
+  0xFC,0x0C,0x0C,0x0C,0x3F,0xFC,0x30,0x30,0x30,0x3F,0xFC,0xFC,0xFF,0x03,0x00,0x3F,
+  0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0xFC,
+  0xFF,0x03,0x00,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x30,
+  0x0C,0x3F,0xFC,0xFC,0xFF,0x03,0x00,0x31,0x8C,0x31,0x8C,0x31,0x8C,0x3F,0xFC,0x31,
+  0x8C,0x31,0x8C,0x31,0x8C,0x3F,0xFC,0xFC,0xFF,0x00,0x00,0x01,0x80,0x03,0xC0,0x06,
+  0x60,0x0C,0x30,0x18,0x18,0x30,0x0C,0x60,0x06,0xFC,0xFF,0x00,0x00,0x06,0x60,0x06,
+  0x60,0x0F,0xF0,0x0F,0xF0,0x19,0x98,0x33,0x0C,0x66,0x06,0xFC,0xFF,0x03,0x00,0x0F,
+  0xF0,0x18,0x18,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x18,0x18,0x0F,0xF0,0xFC,
+  0xFF,0x00,0x00,0x3F,0xFC,0x01,0x80,0x03,0xC0,0x06,0x60,0x0C,0x30,0x18,0x18,0x30,
+  0x0C,0xFC,0xFF,0x00,0x00,0x3F,0xFC,0x06,0x60,0x06,0x60,0x0F,0xF0,0x19,0x98,0x33,
+  0x0C,0x66,0x06,0xFC,0xFF,0x03,0x00,0x01,0x80,0x3F,0xFC,0x01,0x80,0x03,0xC0,0x06,
+  0x60,0x0C,0x30,0x18,0x18,0x30,0x0C,0xAC,0xAE,0x2A,0x00,0x3F,0xFC,0x0C,0x0C,0x0C,
+  0x3F,0xFC,0x0C,0x0C,0x0C,0x0C,0x18,0x5C,0x5D,0x0D,0x00,0x3F,0xFC,0x30,0x30,0x30,
+  0x3F,0xFC,0x30,0x30,0x30,0x3F,0xFC,0xFC,0xFF,0x03,0x00,0x3F,0xFC,0x0C,0x30,0x0C,
+  0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,0xFC,0x3C,0xFF,0x0F,0x00,0x01,
+  0x80,0x3F,0xFC,0x0F,0xF0,0x18,0x18,0x30,0x0C,0x30,0x0C,0x18,0x18,0x0F,0xF0,0x00,
+  0x00,0x00,0x00,0xAC,0xAA,0x02,0x00,0x3F,0xFC,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x18,
+  0xFC,0xFF,0x03,0x00,0x3F,0xFC,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,
+  0x03,0x0C,0x06,0x18,0x54,0x35,0x00,0x00,0x30,0x30,0x30,0x30,0x30,0x3F,0xFC,0x5C,
+  0x35,0x00,0x00,0x3F,0xFC,0x30,0x30,0x30,0x30,0x3F,0xFC,0xFC,0x3F,0x00,0x00,0x3F,
+  0xFC,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x3F,0xFC,0xAC,0xD7,0x00,0x00,0x3F,
+  0xFC,0x0C,0x0C,0x3F,0xFC,0x30,0x30,0x3F,0xFC,0xFC,0x3F,0x00,0x00,0x3F,0xFC,0x30,
+  0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0xFC,0x3F,0x00,0x00,0x30,0x0C,0x30,
+  0x0C,0x3F,0xFC,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0xFC,0x3F,0x00,0x00,0x31,0x8C,0x31,
+  0x8C,0x3F,0xFC,0x31,0x8C,0x31,0x8C,0x3F,0xFC,0xFC,0xFF,0x00,0x00,0x01,0x80,0x03,
+  0xC0,0x06,0x60,0x0C,0x30,0x18,0x18,0x30,0x0C,0x60,0x06,0xFC,0xFF,0x00,0x00,0x06,
+  0x60,0x06,0x60,0x0F,0xF0,0x0F,0xF0,0x19,0x98,0x33,0x0C,0x66,0x06,0xFC,0xFF,0x00,
+  0x00,0x0F,0xF0,0x18,0x18,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x18,0x18,0x0F,0xF0,0xFC,
+  0xFF,0x00,0x00,0x3F,0xFC,0x01,0x80,0x03,0xC0,0x06,0x60,0x0C,0x30,0x18,0x18,0x30,
+  0x0C,0xFC,0xFF,0x00,0x00,0x3F,0xFC,0x06,0x60,0x06,0x60,0x0F,0xF0,0x19,0x98,0x33,
+  0x0C,0x66,0x06,0xFC,0xFF,0x00,0x00,0x01,0x80,0x3F,0xFC,0x01,0x80,0x03,0xC0,0x06,
+  0x60,0x1C,0x38,0x70,0x0E,0xAC,0xAB,0x02,0x00,0x3F,0xFC,0x0C,0x0C,0x3F,0xFC,0x0C,
+  0x0C,0x0C,0x18,0x5C,0xD7,0x00,0x00,0x3F,0xFC,0x30,0x30,0x3F,0xFC,0x30,0x30,0x3F,
+  0xFC,0xFC,0x3F,0x00,0x00,0x3F,0xFC,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,
+  0xFC,0xFC,0xFF,0x00,0x00,0x01,0x80,0x3F,0xFC,0x0F,0xF0,0x18,0x18,0x30,0x0C,0x18,
+  0x18,0x0F,0xF0,0x00,0x00,0x00,0x00,0xFC,0xFF,0x07,0x00,0x7F,0x80,0x01,0x80,0x01,
+  0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0xFC,0xFF,0x01,0x00,
+  0x7F,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x33,0x54,
+  0x55,0x03,0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x7F,0x80,0x5C,0x55,0x03,0x00,
+  0x7F,0x80,0x60,0x60,0x60,0x60,0x60,0x60,0x7F,0x80,0x5C,0x55,0x03,0x00,0x7F,0x80,
+  0x66,0x66,0x66,0x66,0x66,0x66,0x7F,0x80,0xFC,0x5F,0x0D,0x00,0x7F,0x80,0x01,0x80,
+  0x01,0x80,0x01,0x80,0x7F,0x80,0x60,0x60,0x60,0x7F,0x80,0xFC,0xFF,0x03,0x00,0x7F,
+  0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x7F,0x80,0xFC,
+  0xFF,0x03,0x00,0x61,0x80,0x61,0x80,0x61,0x80,0x7F,0x80,0x61,0x80,0x61,0x80,0x61,
+  0x80,0x7F,0x80,0xFC,0xFF,0x03,0x00,0x6D,0x80,0x6D,0x80,0x6D,0x80,0x7F,0x80,0x6D,
+  0x80,0x6D,0x80,0x6D,0x80,0x7F,0x80,0x54,0xD5,0x03,0x00,0x0C,0x0C,0x1E,0x1E,0x33,
+  0x33,0x61,0x80,0x61,0x80,0x54,0xFF,0x03,0x00,0x1B,0x1B,0x1B,0x3F,0x80,0x3F,0x80,
+  0x37,0x80,0x6C,0xC0,0x6C,0xC0,0xD4,0x7F,0x01,0x00,0x1E,0x33,0x61,0x80,0x61,0x80,
+  0x61,0x80,0x61,0x80,0x33,0x1E,0x5C,0x55,0x03,0x00,0x7F,0x80,0x0C,0x0C,0x1E,0x1E,
+  0x33,0x33,0x61,0x80,0x5C,0xFD,0x03,0x00,0x7F,0x80,0x1B,0x1B,0x1B,0x3F,0x80,0x3F,
+  0x80,0x6C,0xC0,0x6C,0xC0,0x74,0x55,0x03,0x00,0x0C,0x7F,0x80,0x0C,0x0C,0x1E,0x1E,
+  0x33,0x61,0x80,0xFC,0xFF,0x07,0x00,0x7F,0x80,0x01,0x80,0x01,0x80,0x7F,0x80,0x01,
+  0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0x5C,0x5D,0x0D,0x00,0x7F,0x80,0x60,0x60,
+  0x60,0x7F,0x80,0x60,0x60,0x60,0x7F,0x80,0x5C,0x55,0x03,0x00,0x7F,0x80,0x33,0x33,
+  0x33,0x33,0x33,0x33,0x7F,0x80,0x34,0xF5,0x05,0x00,0x0C,0x7F,0x80,0x1E,0x33,0x61,
+  0x80,0x61,0x80,0x33,0x1E,0x00,0x00,0x00,0x00,0xFC,0x1F,0x00,0x00,0x7F,0x80,0x01,
+  0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,0xFC,0x1F,0x00,0x00,0x7F,0x80,0x19,0x80,
+  0x19,0x80,0x19,0x80,0x19,0x80,0x33,0x54,0x0D,0x00,0x00,0x60,0x60,0x60,0x60,0x7F,
+  0x80,0x5C,0x0D,0x00,0x00,0x7F,0x80,0x60,0x60,0x60,0x7F,0x80,0x5C,0x0D,0x00,0x00,
+  0x7F,0x80,0x66,0x66,0x66,0x7F,0x80,0xFC,0x0D,0x00,0x00,0x7F,0x80,0x01,0x80,0x7F,
+  0x80,0x60,0x7F,0x80,0xFC,0x0F,0x00,0x00,0x7F,0x80,0x61,0x80,0x61,0x80,0x61,0x80,
+  0x7F,0x80,0xFC,0x3F,0x00,0x00,0x61,0x80,0x61,0x80,0x7F,0x80,0x61,0x80,0x61,0x80,
+  0x7F,0x80,0xFC,0x3F,0x00,0x00,0x6D,0x80,0x6D,0x80,0x7F,0x80,0x6D,0x80,0x6D,0x80,
+  0x7F,0x80,0x54,0x35,0x00,0x00,0x0C,0x0C,0x1E,0x1E,0x33,0x61,0x80,0xD4,0x3F,0x00,
+  0x00,0x1B,0x1B,0x3F,0x80,0x3F,0x80,0x6C,0xC0,0x6C,0xC0,0xD4,0x17,0x00,0x00,0x1E,
+  0x33,0x61,0x80,0x61,0x80,0x33,0x1E,0x5C,0x35,0x00,0x00,0x7F,0x80,0x0C,0x0C,0x1E,
+  0x33,0x61,0x80,0x5C,0x3F,0x00,0x00,0x7F,0x80,0x1B,0x1B,0x3F,0x80,0x3F,0x80,0x6C,
+  0xC0,0x74,0x35,0x00,0x00,0x0C,0x7F,0x80,0x0C,0x1E,0x33,0x61,0x80,0xFC,0x1F,0x00,
+  0x00,0x7F,0x80,0x01,0x80,0x01,0x80,0x7F,0x80,0x01,0x80,0x03,0xDC,0x0D,0x00,0x00,
+  0x7F,0x80,0x60,0x7F,0x80,0x60,0x7F,0x80,0x5C,0x0D,0x00,0x00,0x7F,0x80,0x33,0x33,
+  0x33,0x7F,0x80,0x74,0x17,0x00,0x00,0x0C,0x7F,0x80,0x33,0x61,0x80,0x33,0x1E,0x00,
+  0x00,0x00,0x00,0x54,0x55,0x00,0x00,0x7F,0x03,0x03,0x03,0x06,0x1C,0x70,0xFC,0x5F,
+  0x00,0x00,0x7F,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x33,0x66,0x54,0xD5,
+  0x00,0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x7F,0x80,0x5C,0xD5,0x00,0x00,0x7F,0x80,
+  0x60,0x60,0x60,0x60,0x60,0x7F,0x80,0x5C,0xD5,0x00,0x00,0x7F,0x80,0x66,0x66,0x66,
+  0x66,0x66,0x7F,0x80,0xFC,0xD7,0x00,0x00,0x7F,0x80,0x01,0x80,0x01,0x80,0x7F,0x80,
+  0x60,0x60,0x7F,0x80,0xFC,0xFF,0x00,0x00,0x7F,0x80,0x61,0x80,0x61,0x80,0x61,0x80,
+  0x61,0x80,0x61,0x80,0x7F,0x80,0xFC,0xFF,0x00,0x00,0x61,0x80,0x61,0x80,0x61,0x80,
+  0x7F,0x80,0x61,0x80,0x61,0x80,0x7F,0x80,0xFC,0xFF,0x00,0x00,0x6D,0x80,0x6D,0x80,
+  0x6D,0x80,0x7F,0x80,0x6D,0x80,0x6D,0x80,0x7F,0x80,0x54,0xD5,0x00,0x00,0x0C,0x0C,
+  0x1E,0x1E,0x37,0x33,0x61,0x80,0x54,0xFD,0x00,0x00,0x1B,0x1B,0x1B,0x1B,0x3F,0x80,
+  0x3F,0x80,0x6C,0xC0,0xD4,0x5F,0x00,0x00,0x1E,0x33,0x61,0x80,0x61,0x80,0x61,0x80,
+  0x33,0x1E,0x5C,0xD5,0x00,0x00,0x7F,0x80,0x0C,0x0C,0x1E,0x1E,0x33,0x61,0x80,0x5C,
+  0xFD,0x00,0x00,0x7F,0xC0,0x1B,0x1B,0x1B,0x3F,0x80,0x3F,0x80,0x6C,0xC0,0x74,0xD5,
+  0x00,0x00,0x0C,0x7F,0x80,0x0C,0x1E,0x1E,0x33,0x61,0x80,0x54,0x55,0x00,0x00,0x7F,
+  0x03,0x03,0x7F,0x06,0x0C,0x78,0x5C,0xD7,0x00,0x00,0x7F,0x80,0x60,0x60,0x7F,0x80,
+  0x60,0x60,0x7F,0x80,0x5C,0xD5,0x00,0x00,0x7F,0x80,0x33,0x33,0x33,0x33,0x33,0x7F,
+  0x80,0x74,0x5F,0x00,0x00,0x0C,0x7F,0x80,0x33,0x61,0x80,0x61,0x80,0x33,0x1E,0x00,
+  0x00,0x00,0x00,0xAC,0x2A,0x00,0x00,0x3F,0xFC,0x0C,0x0C,0x0C,0x0C,0x18,0xFC,0x0F,
+  0x00,0x00,0x3F,0xFC,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x54,0x0D,0x00,0x00,
+  0x30,0x30,0x30,0x30,0x3F,0xFC,0x5C,0x0D,0x00,0x00,0x3F,0xFC,0x30,0x30,0x30,0x3F,
+  0xFC,0xFC,0x0F,0x00,0x00,0x3F,0xFC,0x30,0xC0,0x30,0xC0,0x30,0xC0,0x3F,0xFC,0xEC,
+  0x0D,0x00,0x00,0x3F,0xFC,0x0C,0x3F,0xFC,0x30,0x3F,0xFC,0xFC,0x0F,0x00,0x00,0x3F,
+  0xFC,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0xFC,0x0F,0x00,0x00,0x30,0x0C,0x30,
+  0x0C,0x3F,0xFC,0x30,0x0C,0x3F,0xFC,0xFC,0x0F,0x00,0x00,0x31,0x8C,0x31,0x8C,0x3F,
+  0xFC,0x31,0x8C,0x3F,0xFC,0xFC,0x0F,0x00,0x00,0x01,0x80,0x01,0x80,0x03,0xC0,0x0E,
+  0x70,0x38,0x1C,0xFC,0x0F,0x00,0x00,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x1E,0x78,0x73,
+  0xCE,0xFC,0x0F,0x00,0x00,0x0F,0xF0,0x18,0x18,0x30,0x0C,0x18,0x18,0x0F,0xF0,0xFC,
+  0x0F,0x00,0x00,0x3F,0xFC,0x01,0x80,0x03,0xC0,0x0E,0x70,0x38,0x1C,0xFC,0x0F,0x00,
+  0x00,0x3F,0xFC,0x0C,0x30,0x0C,0x30,0x1E,0x78,0x73,0xCE,0xFC,0x0F,0x00,0x00,0x01,
+  0x80,0x3F,0xFC,0x03,0xC0,0x0E,0x70,0x38,0x1C,0xEC,0x2A,0x00,0x00,0x3F,0xFC,0x0C,
+  0x3F,0xFC,0x0C,0x0C,0x18,0xDC,0x0D,0x00,0x00,0x3F,0xFC,0x30,0x3F,0xFC,0x30,0x3F,
+  0xFC,0xFC,0x0F,0x00,0x00,0x3F,0xFC,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,0xFC,0xFF,
+  0x0F,0x00,0x00,0x01,0x80,0x3F,0xFC,0x18,0x18,0x30,0x0C,0x18,0x18,0x0F,0xF0,0x00,
+  0x00,0x00,0x00,0xFC,0x07,0x00,0x00,0x7F,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x03,
+  0xFC,0x07,0x00,0x00,0x7F,0x80,0x19,0x80,0x19,0x80,0x19,0x80,0x33,0x54,0x03,0x00,
+  0x00,0x60,0x60,0x60,0x7F,0x80,0x5C,0x03,0x00,0x00,0x7F,0x80,0x60,0x60,0x7F,0x80,
+  0x5C,0x03,0x00,0x00,0x7F,0x80,0x66,0x66,0x7F,0x80,0xFC,0x0D,0x00,0x00,0x7F,0x80,
+  0x01,0x80,0x7F,0x80,0x60,0x7F,0x80,0xFC,0x03,0x00,0x00,0x7F,0x80,0x61,0x80,0x61,
+  0x80,0x7F,0x80,0xFC,0x03,0x00,0x00,0x61,0x80,0x7F,0x80,0x61,0x80,0x7F,0x80,0xFC,
+  0x03,0x00,0x00,0x6D,0x80,0x7F,0x80,0x6D,0x80,0x7F,0x80,0x54,0x03,0x00,0x00,0x0C,
+  0x0C,0x1E,0x73,0x80,0xD4,0x03,0x00,0x00,0x1B,0x1F,0x37,0x80,0x6C,0xC0,0xD4,0x05,
+  0x00,0x00,0x1E,0x33,0x61,0x80,0x33,0x1E,0x5C,0x03,0x00,0x00,0x7F,0x80,0x0C,0x1E,
+  0x73,0x80,0xDC,0x03,0x00,0x00,0x7F,0x80,0x1B,0x3F,0x80,0x6C,0xC0,0x74,0x0D,0x00,
+  0x00,0x0C,0x7F,0x80,0x0C,0x1E,0x73,0x80,0xFC,0x0F,0x00,0x00,0x7F,0x80,0x01,0x80,
+  0x7F,0x80,0x01,0x80,0x01,0x80,0x5C,0x0D,0x00,0x00,0x7F,0x80,0x60,0x7F,0x60,0x7F,
+  0x80,0x5C,0x03,0x00,0x00,0x7F,0x80,0x33,0x33,0x7F,0x80,0x74,0x17,0x00,0x00,0x0C,
+  0x7F,0x80,0x33,0x61,0x80,0x33,0x1E,0x00,0x00,0x00,0x00,0xA8,0xAA,0xAA,0x0A,0x18,
+  0x18,0x18,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0xA8,0xAA,0xAA,0x0A,
+  0x36,0x36,0x36,0x36,0x36,0x3E,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0xA8,0xAA,0xAA,
+  0x0A,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,0x18,0xA8,0xAA,
+  0xAA,0x0A,0x36,0x36,0x36,0x3E,0x36,0x36,0x36,0x3E,0x36,0x36,0x36,0x36,0x36,0xA8,
+  0xAA,0xAA,0x0A,0x0C,0x0C,0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0xA8,0xBA,0xAA,0x0A,0x36,0x36,0x36,0x36,0x36,0x01,0xF6,0x36,0x36,0x36,0x36,0x36,
+  0x36,0x36,0xA8,0xAA,0xAA,0x0A,0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,
+  0x0C,0x0C,0x0C,0xA8,0xAB,0xAB,0x0A,0x36,0x36,0x36,0x01,0xF6,0x36,0x36,0x36,0x01,
+  0xF6,0x36,0x36,0x36,0x36,0x36,0x00,0x00,0x55,0x03,0x03,0x03,0x03,0x03,0x7F,0xFE,
+  0xA8,0xEA,0xFF,0x0A,0x18,0x18,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,
+  0x18,0x18,0x7F,0xF8,0x18,0x18,0xA8,0xEA,0xFF,0x0A,0x36,0x36,0x36,0x36,0x36,0x3E,
+  0x18,0x36,0x18,0x36,0x18,0x36,0x18,0x36,0x7F,0xF6,0x36,0x36,0xA8,0xEA,0xFF,0x0A,
+  0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x0C,0x7F,0xFC,
+  0x0C,0x0C,0x00,0x00,0xFF,0x03,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xC0,0x7F,0xFE,
+  0x00,0x00,0xFC,0x0F,0x7F,0xFE,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0xA8,0xAA,
+  0xFF,0x0B,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0x0C,0x0C,0xFC,0x0C,
+  0x0C,0x0C,0x0C,0x0C,0xA8,0xAA,0xFF,0x0B,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x7F,
+  0xF6,0x0C,0x36,0x0C,0xF6,0x0C,0x36,0x0C,0x36,0x36,0xA8,0xAA,0xFF,0x0B,0x0C,0x0C,
+  0x0C,0x0C,0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0x00,0x00,0xFC,0x0F,0x7F,0xFE,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,
+  0x00,0x03,0x7F,0xFE,0xA8,0xAA,0xEA,0x0A,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0x0C,0x0C,0x7F,0xFC,0x0C,0x0C,0xA8,0xAA,0xAA,0x0A,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x00,0x00,0x00,0x00,0xA8,0xAA,0xAA,0x0A,0x18,
+  0x18,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0xA8,0xAA,0xAA,0x0A,
+  0x36,0x36,0x36,0x36,0x36,0x3E,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0xA8,0xAA,0xAA,
+  0x0A,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,0x18,0xA8,0xAA,
+  0xAA,0x0A,0x36,0x36,0x36,0x3E,0x36,0x36,0x36,0x3E,0x36,0x36,0x36,0x36,0x36,0xA8,
+  0xAA,0xAA,0x0A,0x0C,0x0C,0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0xA8,0xBA,0xAA,0x0A,0x36,0x36,0x36,0x36,0x36,0x01,0xF6,0x36,0x36,0x36,0x36,0x36,
+  0x36,0x36,0xA8,0xAA,0xAA,0x0A,0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,
+  0x0C,0x0C,0x0C,0xA8,0xEB,0xAA,0x0A,0x36,0x36,0x36,0x01,0xF6,0x36,0x36,0x01,0xF6,
+  0x36,0x36,0x36,0x36,0x36,0x36,0x00,0x00,0xFC,0x03,0x01,0x80,0x01,0x80,0x01,0x80,
+  0x7F,0xFE,0xA8,0xAA,0xFE,0x0A,0x18,0x18,0x18,0x18,0x18,0x1F,0x18,0x18,0x0C,0x18,
+  0x0C,0x18,0x7F,0xF8,0x18,0x18,0xA8,0xAA,0xFE,0x0A,0x36,0x36,0x36,0x36,0x36,0x3E,
+  0x36,0x36,0x0C,0x36,0x0C,0x36,0x7F,0xF6,0x36,0x36,0xA8,0xAA,0xFE,0x0A,0x0C,0x0C,
+  0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0x0C,0x00,0x00,
+  0xFC,0x03,0x06,0x60,0x06,0x60,0x06,0x60,0x7F,0xFE,0x00,0x00,0xFC,0x0F,0x7F,0xFE,
+  0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0xA8,0xAA,0xFF,0x0B,0x0C,0x0C,0x0C,0x0C,
+  0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,0x0C,0x0C,0xA8,0xAA,
+  0xFF,0x0B,0x36,0x36,0x36,0x36,0x36,0x36,0x36,0x7F,0xF6,0x0C,0x36,0x0C,0xF6,0x0C,
+  0x36,0x0C,0x36,0x36,0xA8,0xAA,0xFF,0x0B,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x7F,
+  0xFC,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x00,0x00,0xFC,0x0F,0x7F,0xFE,
+  0x0C,0x30,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x00,0x00,0x00,0x03,0x7F,0xFE,0xA8,0xAA,
+  0xEA,0x0A,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0x0C,
+  0xA8,0xAA,0xAA,0x0A,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0x0C,0x00,0x00,0x00,0x00,0xA8,0xAA,0x02,0x00,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,
+  0x18,0xA8,0xAA,0x02,0x00,0x36,0x36,0x36,0x3E,0x36,0x36,0x36,0x36,0xA8,0xAA,0x02,
+  0x00,0x18,0x18,0x1F,0x18,0x18,0x1F,0x18,0x18,0xA8,0xAA,0x02,0x00,0x36,0x36,0x3E,
+  0x36,0x36,0x3E,0x36,0x36,0xA8,0xAA,0x02,0x00,0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,
+  0x0C,0xA8,0xAB,0x02,0x00,0x36,0x36,0x36,0x01,0xF6,0x36,0x36,0x36,0x36,0xA8,0xAA,
+  0x02,0x00,0x0C,0xFC,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,0xB8,0xAE,0x02,0x00,0x36,0x01,
+  0xF6,0x36,0x36,0x01,0xF6,0x36,0x36,0x36,0x00,0xFC,0x00,0x00,0x01,0x80,0x01,0x80,
+  0x7F,0xFE,0xA8,0xFE,0x02,0x00,0x18,0x18,0x18,0x1F,0x0C,0x18,0x0C,0x18,0x7F,0xF8,
+  0x18,0xA8,0xFE,0x02,0x00,0x36,0x36,0x36,0x3E,0x0C,0x36,0x0C,0x36,0x7F,0xF6,0x36,
+  0xA8,0xFE,0x02,0x00,0x0C,0x0C,0x0C,0x0C,0x06,0x0C,0x06,0x0C,0x7F,0xFC,0x0C,0x00,
+  0xFC,0x00,0x00,0x06,0x60,0x06,0x60,0x7F,0xFE,0x00,0xC0,0x0F,0x00,0x7F,0xFE,0x01,
+  0x80,0x01,0x80,0xA8,0xFA,0x03,0x00,0x0C,0x0C,0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0x7C,
+  0x0C,0x0C,0xA8,0xFA,0x03,0x00,0x36,0x36,0x36,0x36,0x36,0x7F,0xF6,0x0C,0xF6,0x0C,
+  0x36,0xA8,0xFA,0x03,0x00,0x0C,0x0C,0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0x0C,0x0C,0x0C,
+  0x00,0xC0,0x0F,0x00,0x7F,0xFE,0x0C,0x30,0x0C,0x30,0x00,0xC0,0x00,0x00,0x7F,0xFE,
+  0xA8,0xEA,0x02,0x00,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0xA8,0xAA,0x02,
+  0x00,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x00,0x00,0x00,0x00,0xA8,0xAA,0x02,
+  0x00,0x18,0x18,0x18,0x1F,0x18,0x18,0x18,0x18,0xA8,0xAA,0x02,0x00,0x36,0x36,0x36,
+  0x3E,0x36,0x36,0x36,0x36,0xA8,0xAA,0x02,0x00,0x18,0x18,0x1F,0x18,0x18,0x1F,0x18,
+  0x18,0xA8,0xAA,0x02,0x00,0x36,0x36,0x3E,0x36,0x36,0x3E,0x36,0x36,0xA8,0xAA,0x02,
+  0x00,0x0C,0x0C,0x0C,0xFC,0x0C,0x0C,0x0C,0x0C,0xA8,0xAB,0x02,0x00,0x36,0x36,0x36,
+  0x01,0xF6,0x36,0x36,0x36,0x36,0xA8,0xAA,0x02,0x00,0x0C,0x0C,0xFC,0x0C,0xFC,0x0C,
+  0x0C,0x0C,0xE8,0xAE,0x02,0x00,0x36,0x36,0x01,0xF6,0x36,0x01,0xF6,0x36,0x36,0x36,
+  0x00,0xFC,0x00,0x00,0x01,0x80,0x01,0x80,0x7F,0xFE,0xA8,0xFE,0x02,0x00,0x18,0x18,
+  0x18,0x1F,0x0C,0x18,0x0C,0x18,0x7F,0xF8,0x18,0xA8,0xFE,0x02,0x00,0x36,0x36,0x36,
+  0x3E,0x0C,0x36,0x0C,0x36,0x7F,0xF6,0x36,0xA8,0xFE,0x02,0x00,0x0C,0x0C,0x0C,0x0C,
+  0x06,0x0C,0x06,0x0C,0x7F,0xFC,0x0C,0x00,0xFC,0x00,0x00,0x06,0x60,0x06,0x60,0x7F,
+  0xFE,0x00,0xC0,0x0F,0x00,0x7F,0xFE,0x01,0x80,0x01,0x80,0xA8,0xFA,0x03,0x00,0x0C,
+  0x0C,0x0C,0x0C,0x0C,0x7F,0xFC,0x0C,0x7C,0x0C,0x0C,0xA8,0xFA,0x03,0x00,0x36,0x36,
+  0x36,0x36,0x36,0x7F,0xF6,0x0C,0xF6,0x0C,0x36,0xA8,0xFA,0x03,0x00,0x0C,0x0C,0x0C,
+  0x0C,0x0C,0x7F,0xFC,0x0C,0x0C,0x0C,0x0C,0x00,0xC0,0x0F,0x00,0x7F,0xFE,0x0C,0x30,
+  0x0C,0x30,0x00,0xC0,0x00,0x00,0x7F,0xFE,0xA8,0xEA,0x02,0x00,0x0C,0x0C,0x0C,0x0C,
+  0x0C,0x0C,0x7F,0xFC,0x0C,0xA8,0xAA,0x02,0x00,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,
+  0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x0A,0x3F,0xF8,0x18,0x18,0x18,0x18,0x00,
+  0x00,0xFC,0x0F,0x3F,0xF8,0x06,0x18,0x06,0x18,0x06,0x18,0x06,0x18,0x00,0x00,0xFC,
+  0x0F,0x3E,0x30,0x06,0x30,0x06,0x30,0x06,0x78,0x06,0xCC,0x00,0x00,0x54,0x0D,0x30,
+  0x30,0x30,0x30,0x3F,0xF8,0x00,0x00,0xFC,0x0F,0x30,0xFC,0x30,0x30,0x30,0x30,0x30,
+  0x78,0x3E,0xCC,0x00,0x00,0xFC,0x0F,0x30,0x30,0x30,0xFC,0x30,0x78,0x30,0xCC,0x3E,
+  0x78,0x00,0x00,0x5C,0x0D,0x3F,0xF8,0x30,0x30,0x30,0x3F,0xF8,0x00,0x00,0xEC,0x0D,
+  0x3F,0xF8,0x18,0x3F,0xF8,0x30,0x3F,0xF8,0x00,0x00,0xFC,0x0F,0x3F,0xF8,0x03,0x18,
+  0x3F,0x18,0x30,0x18,0x3F,0x18,0x00,0x00,0xFC,0x0F,0x3F,0xF8,0x07,0x98,0x3F,0x98,
+  0x31,0x98,0x3F,0xF8,0x00,0x00,0xFC,0x0F,0x3F,0x98,0x07,0x98,0x3F,0xF8,0x31,0x98,
+  0x3F,0xF8,0x00,0x00,0xFC,0x0F,0x3F,0x30,0x03,0x30,0x3F,0x30,0x30,0x78,0x3F,0xCC,
+  0x00,0x00,0xFC,0x0F,0x3F,0xF8,0x07,0x80,0x3F,0xF8,0x31,0x80,0x3F,0xF8,0x00,0x00,
+  0xFC,0x0F,0x3F,0xFC,0x06,0xD8,0x3E,0xD8,0x30,0xD8,0x3F,0xFC,0x00,0x00,0xFC,0x0F,
+  0x3E,0x30,0x06,0xFC,0x3E,0x78,0x30,0xCC,0x3E,0x78,0x00,0x00,0xFC,0x0F,0x3F,0xF8,
+  0x30,0x18,0x30,0x18,0x30,0x18,0x3F,0xF8,0x00,0x00,0xFC,0x0F,0x30,0x18,0x30,0x18,
+  0x3F,0xF8,0x30,0x18,0x3F,0xF8,0x00,0x00,0xFC,0x0F,0x33,0x30,0x33,0x30,0x3F,0x30,
+  0x33,0x78,0x3F,0xCC,0x00,0x00,0xFC,0x0F,0x01,0x80,0x01,0x80,0x03,0xC0,0x0E,0x70,
+  0x38,0x1C,0x00,0x00,0xFC,0x0F,0x06,0x60,0x06,0x60,0x0F,0xF0,0x19,0x98,0x33,0x0C,
+  0x00,0x00,0xFC,0x0F,0x0F,0xE0,0x18,0x30,0x30,0x18,0x18,0x30,0x0F,0xE0,0x00,0x00,
+  0xFC,0x0F,0x3F,0xF8,0x01,0x80,0x03,0xC0,0x0E,0x70,0x38,0x1C,0x00,0x00,0xFF,0x0F,
+  0x01,0x80,0x3F,0xF8,0x01,0x80,0x03,0xC0,0x0E,0x70,0x38,0x1C,0x00,0x00,0xEC,0x0A,
+  0x3F,0xF8,0x18,0x3F,0xF8,0x18,0x18,0x00,0x00,0xDC,0x0D,0x3F,0xF8,0x30,0x3F,0xF8,
+  0x30,0x3F,0xF8,0x00,0x00,0xFC,0x0F,0x3F,0xFC,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,
+  0xFC,0x00,0x00,0xFF,0x0F,0x03,0x80,0x3F,0xF8,0x18,0x30,0x30,0x18,0x18,0x30,0x0F,
+  0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x0A,0x3F,0xFC,0x0C,0x0C,0x0C,0x0C,0x00,
+  0x00,0xFC,0x0F,0x3F,0xFC,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x00,0x00,0xFC,
+  0x0F,0x3F,0x18,0x03,0x18,0x03,0x18,0x03,0x3C,0x03,0x66,0x00,0x00,0x54,0x0D,0x30,
+  0x30,0x30,0x30,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x30,0xFC,0x30,0x30,0x30,0x30,0x30,
+  0x78,0x3E,0xCC,0x00,0x00,0xFC,0x0F,0x30,0x30,0x30,0xFC,0x30,0x78,0x30,0xCC,0x3F,
+  0x78,0x00,0x00,0x5C,0x0D,0x3F,0xFC,0x30,0x30,0x30,0x3F,0xFC,0x00,0x00,0xEC,0x0D,
+  0x3F,0xFC,0x0C,0x3F,0xFC,0x30,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x3F,0xFC,0x03,0x0C,
+  0x3F,0x0C,0x30,0x0C,0x3F,0x0C,0x00,0x00,0xFC,0x0F,0x3F,0xFC,0x03,0xCC,0x3F,0xCC,
+  0x30,0xCC,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x3F,0xCC,0x03,0xCC,0x3F,0xFC,0x38,0xCC,
+  0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x3F,0x18,0x03,0x18,0x3F,0x18,0x30,0x3C,0x3F,0x66,
+  0x00,0x00,0xFC,0x0F,0x3F,0xFC,0x01,0xC0,0x3F,0xFC,0x30,0xC0,0x3F,0xFC,0x00,0x00,
+  0xFC,0x0F,0x3F,0xFE,0x03,0x6C,0x3F,0x6C,0x30,0x6C,0x3F,0xFE,0x00,0x00,0xFC,0x0F,
+  0x3F,0x18,0x03,0x7E,0x3F,0x3C,0x30,0x66,0x3F,0x3C,0x00,0x00,0xFC,0x0F,0x3F,0xFC,
+  0x30,0x0C,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x30,0x0C,0x30,0x0C,
+  0x3F,0xFC,0x30,0x0C,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x33,0x18,0x33,0x18,0x3F,0x18,
+  0x33,0x3C,0x3F,0x66,0x00,0x00,0xFC,0x0F,0x01,0x80,0x01,0x80,0x03,0xC0,0x0E,0x70,
+  0x38,0x1C,0x00,0x00,0xFC,0x0F,0x06,0x60,0x06,0x60,0x0F,0xF0,0x19,0x98,0x33,0x0C,
+  0x00,0x00,0xFC,0x0F,0x0F,0xF0,0x18,0x18,0x30,0x0C,0x18,0x18,0x0F,0xF0,0x00,0x00,
+  0xFC,0x0F,0x3F,0xFC,0x01,0x80,0x03,0xC0,0x0E,0x70,0x38,0x1C,0x00,0x00,0xFF,0x0F,
+  0x01,0x80,0x3F,0xFC,0x01,0x80,0x03,0xC0,0x0E,0x70,0x38,0x1C,0x00,0x00,0xEC,0x0A,
+  0x3F,0xFC,0x0C,0x3F,0xFC,0x0C,0x0C,0x00,0x00,0xDC,0x0D,0x3F,0xFC,0x30,0x3F,0xFC,
+  0x30,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x3F,0xFC,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,
+  0xFC,0x00,0x00,0xFF,0x0F,0x01,0x80,0x3F,0xFC,0x18,0x18,0x30,0x0C,0x18,0x18,0x0F,
+  0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0xAC,0x0A,0x3F,0xFE,0x06,0x06,0x06,0x06,0x00,
+  0x00,0xFC,0x0F,0x3F,0xFE,0x03,0x06,0x03,0x06,0x03,0x06,0x03,0x06,0x00,0x00,0xFC,
+  0x0F,0x3F,0x18,0x03,0x18,0x03,0x3C,0x03,0x66,0x03,0xC3,0x00,0x00,0x54,0x0D,0x30,
+  0x30,0x30,0x30,0x3F,0xFE,0x00,0x00,0xFC,0x0F,0x30,0xFE,0x30,0x18,0x30,0x38,0x30,
+  0x6C,0x3E,0xC6,0x00,0x00,0xFC,0x0F,0x30,0x38,0x30,0xFE,0x30,0x7C,0x30,0xC6,0x3E,
+  0x7C,0x00,0x00,0x5C,0x0D,0x3F,0xFE,0x30,0x30,0x30,0x3F,0xFE,0x00,0x00,0xEC,0x0D,
+  0x3F,0xFE,0x06,0x3F,0xFE,0x30,0x3F,0xFE,0x00,0x00,0xFC,0x0F,0x3F,0xFE,0x01,0x86,
+  0x3F,0x86,0x30,0x06,0x3F,0x86,0x00,0x00,0xFC,0x0F,0x3F,0xFE,0x03,0xC6,0x3F,0xC6,
+  0x30,0xC6,0x3F,0xFE,0x00,0x00,0xFC,0x0F,0x3F,0xC6,0x03,0xC6,0x3F,0xFE,0x30,0xC6,
+  0x3F,0xFE,0x00,0x00,0xFC,0x0F,0x3F,0x18,0x03,0x18,0x3F,0x3C,0x30,0x66,0x3F,0xC3,
+  0x00,0x00,0xFC,0x0F,0x3F,0xFE,0x03,0xC0,0x3F,0xFE,0x30,0xC0,0x3F,0xFE,0x00,0x00,
+  0xFC,0x0F,0x3F,0xFE,0x03,0x6C,0x3F,0x6C,0x30,0x6C,0x3F,0xFE,0x00,0x00,0xFC,0x0F,
+  0x3F,0x18,0x03,0x7E,0x3F,0x3C,0x30,0x66,0x3F,0x3C,0x00,0x00,0xFC,0x0F,0x3F,0xFE,
+  0x30,0x06,0x30,0x06,0x30,0x06,0x3F,0xFE,0x00,0x00,0xFC,0x0F,0x30,0x06,0x30,0x06,
+  0x3F,0xFE,0x30,0x06,0x3F,0xFE,0x00,0x00,0xFC,0x0F,0x33,0x18,0x33,0x18,0x3F,0x3C,
+  0x33,0x66,0x3F,0xC3,0x00,0x00,0xE8,0x0F,0xC0,0xC0,0x01,0xE0,0x07,0x38,0x3C,0x0E,
+  0x00,0x00,0xFC,0x0F,0x06,0x18,0x06,0x18,0x0F,0x3C,0x19,0xE6,0x30,0xC3,0x00,0x00,
+  0xFC,0x0F,0x0F,0xF8,0x18,0x0C,0x30,0x06,0x18,0x0C,0x0F,0xF8,0x00,0x00,0xEC,0x0F,
+  0x3F,0xFE,0xC0,0x01,0xE0,0x07,0x38,0x3C,0x0E,0x00,0x00,0xEF,0x0F,0x01,0xC0,0x3F,
+  0xFE,0xC0,0x01,0xE0,0x07,0x38,0x3C,0x0E,0x00,0x00,0xEC,0x0A,0x3F,0xFE,0x06,0x3F,
+  0xFE,0x06,0x06,0x00,0x00,0xDC,0x0D,0x3F,0xFE,0x30,0x3F,0xFE,0x30,0x3F,0xFE,0x00,
+  0x00,0xFC,0x0F,0x3F,0xFE,0x0C,0x18,0x0C,0x18,0x0C,0x18,0x3F,0xFE,0x00,0x00,0xFF,
+  0x0F,0x01,0xC0,0x3F,0xFE,0x18,0x0C,0x30,0x06,0x18,0x0C,0x0F,0xF8,0x00,0x00,0x00,
+  0x00,0x00,0x00,0xAC,0x0A,0x3F,0xFC,0x0C,0x0C,0x0C,0x0C,0x00,0x00,0xFC,0x0F,0x3F,
+  0xFC,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x00,0x00,0xFC,0x0F,0x3E,0x30,0x06,
+  0x30,0x06,0x30,0x06,0x78,0x06,0xCC,0x00,0x00,0x54,0x0D,0x30,0x30,0x30,0x30,0x3F,
+  0xFC,0x00,0x00,0xFC,0x0F,0x30,0xFC,0x30,0x30,0x30,0x30,0x30,0x78,0x3E,0xCC,0x00,
+  0x00,0xFC,0x0F,0x30,0x70,0x31,0xFC,0x30,0xF8,0x31,0x8C,0x3E,0xF8,0x00,0x00,0x5C,
+  0x0D,0x3F,0xFC,0x30,0x30,0x30,0x3F,0xFC,0x00,0x00,0xEC,0x0D,0x3F,0xFC,0x0C,0x3F,
+  0xFC,0x30,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x3F,0xFC,0x03,0x0C,0x3F,0x0C,0x30,0x0C,
+  0x3F,0x0C,0x00,0x00,0xFC,0x0F,0x3F,0xFC,0x03,0xCC,0x3F,0xCC,0x30,0xCC,0x3F,0xFC,
+  0x00,0x00,0xFC,0x0F,0x3F,0xCC,0x03,0xCC,0x3F,0xFC,0x30,0xCC,0x3F,0xFC,0x00,0x00,
+  0xFC,0x0F,0x3F,0x30,0x03,0x30,0x3F,0x30,0x30,0x78,0x3F,0xCC,0x00,0x00,0xFC,0x0F,
+  0x3F,0xFC,0x03,0xC0,0x3F,0xFC,0x30,0xC0,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x3F,0xFC,
+  0x06,0xD8,0x3E,0xD8,0x30,0xD8,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x3F,0x30,0x03,0xFC,
+  0x3F,0x78,0x30,0xCC,0x3F,0x78,0x00,0x00,0xFC,0x0F,0x3F,0xFC,0x30,0x0C,0x30,0x0C,
+  0x30,0x0C,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x30,0x0C,0x30,0x0C,0x3F,0xFC,0x30,0x0C,
+  0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x33,0x30,0x33,0x30,0x3F,0x30,0x33,0x78,0x3F,0xCC,
+  0x00,0x00,0xFC,0x0F,0x01,0x80,0x01,0x80,0x03,0xC0,0x0E,0x70,0x38,0x1C,0x00,0x00,
+  0xFC,0x0F,0x0C,0x30,0x0C,0x30,0x1E,0x78,0x33,0xCC,0x61,0x86,0x00,0x00,0xFC,0x0F,
+  0x0F,0xF0,0x18,0x18,0x30,0x0C,0x18,0x18,0x0F,0xF0,0x00,0x00,0xFC,0x0F,0x3F,0xFC,
+  0x01,0x80,0x03,0xC0,0x0E,0x70,0x38,0x1C,0x00,0x00,0xFC,0x0F,0x01,0x80,0x3F,0xFC,
+  0x03,0xC0,0x0E,0x70,0x38,0x1C,0x00,0x00,0xEC,0x0A,0x3F,0xFC,0x0C,0x3F,0xFC,0x0C,
+  0x0C,0x00,0x00,0xDC,0x0D,0x3F,0xFC,0x30,0x3F,0xFC,0x30,0x3F,0xFC,0x00,0x00,0xFC,
+  0x0F,0x3F,0xFC,0x0C,0x30,0x0C,0x30,0x0C,0x30,0x3F,0xFC,0x00,0x00,0xFC,0x0F,0x01,
+  0x80,0x3F,0xFC,0x18,0x18,0x30,0x0C,0x1F,0xF8,
+};
+
+// 영문 128자, 마스크 2바이트
+const uint16_t PACKED_ENGLISH_OFFSET[128] = {
+  0x0000,0x0002,0x0014,0x0026,0x0034,0x0042,0x0052,0x0062,0x006C,0x007E,0x008C,0x009E,
+  0x00AC,0x00BA,0x00C5,0x00D3,0x00E3,0x00F1,0x00FF,0x010D,0x0119,0x0127,0x0135,0x013E,
+  0x014C,0x0156,0x0160,0x016B,0x0176,0x0181,0x018F,0x019B,0x01A7,0x01A9,0x01B1,0x01B9,
+  0x01C9,0x01D7,0x01E7,0x01F6,0x01FB,0x0205,0x020F,0x021D,0x0227,0x022C,0x0234,0x0238,
+  0x0242,0x0250,0x0259,0x0267,0x0275,0x0282,0x0290,0x029D,0x02A7,0x02B5,0x02C2,0x02C8,
+  0x02CF,0x02DC,0x02EA,0x02F7,0x0301,0x030F,0x031D,0x032B,0x0339,0x0347,0x0355,0x035F,
+  0x036D,0x0379,0x0383,0x038D,0x039A,0x03A4,0x03B1,0x03BE,0x03CC,0x03D6,0x03E4,0x03F2,
+  0x0400,0x040A,0x0416,0x0422,0x0430,0x043E,0x0448,0x0456,0x0460,0x046A,0x0474,0x047C,
+  0x0486,0x048B,0x0498,0x04A6,0x04B4,0x04C2,0x04D0,0x04DA,0x04E8,0x04F4,0x04FD,0x0507,
+  0x0514,0x051D,0x052B,0x0537,0x0545,0x0553,0x0561,0x056C,0x057A,0x0586,0x0592,0x059E,
+  0x05AB,0x05BA,0x05C6,0x05D4,0x05DF,0x05E5,0x05F0,0x05F9,
+};
+const uint8_t PACKED_ENGLISH_DATA[1536] = {
+  0x00,0x00,0xFF,0xFF,0x0F,0x10,0x14,0x10,0x10,0x14,0x10,0x0F,0xE0,0x10,0x90,0xD0,
+  0xD0,0x90,0x10,0xE0,0xFF,0xFF,0x0F,0x1F,0x1B,0x1F,0x1F,0x1B,0x1F,0x0F,0xE0,0xF0,
+  0x70,0x30,0x30,0x70,0xF0,0xE0,0xFE,0x7C,0x0F,0x1F,0x1F,0x0F,0x1F,0x1F,0x0F,0xC0,
+  0xE0,0xF0,0xE0,0xC0,0xFE,0x7C,0x01,0x03,0x07,0x0F,0x07,0x03,0x01,0x80,0xC0,0xE0,
+  0xC0,0x80,0xFE,0xFE,0x03,0x03,0x1F,0x1F,0x1F,0x03,0x03,0xC0,0xD0,0x90,0xF0,0x90,
+  0xD0,0xC0,0xFE,0xFE,0x03,0x07,0x0F,0x1F,0x0F,0x07,0x03,0x80,0xD0,0xD0,0xF0,0xD0,
+  0xD0,0x80,0x3C,0x3C,0x01,0x03,0x03,0x01,0x80,0xC0,0xC0,0x80,0xFF,0xFF,0x7F,0x7F,
+  0x7E,0x7C,0x7C,0x7E,0x7F,0x7F,0xFE,0xFE,0x7E,0x3E,0x3E,0x7E,0xFE,0xFE,0x7E,0x7E,
+  0x03,0x06,0x04,0x04,0x06,0x03,0xC0,0x60,0x20,0x20,0x60,0xC0,0xFF,0xFF,0x7F,0x7C,
+  0x79,0x7B,0x7B,0x79,0x7C,0x7F,0xFE,0x3E,0x9E,0xDE,0xDE,0x9E,0x3E,0xFE,0xFC,0x7E,
+  0x01,0x03,0x17,0x1D,0x18,0x1E,0xE0,0xF0,0x10,0x10,0xF0,0xE0,0x7E,0x7E,0x0E,0x1F,
+  0x11,0x11,0x1F,0x0E,0x40,0x40,0xF0,0xF0,0x40,0x40,0xF8,0x1E,0x1F,0x1F,0x0C,0x06,
+  0x03,0x60,0xF0,0xF0,0xE0,0xFC,0xEE,0x1F,0x1F,0x14,0x14,0x1F,0x1F,0xE0,0xE0,0xC0,
+  0x70,0xF0,0xE0,0xFE,0xFE,0x08,0x03,0x07,0x14,0x07,0x03,0x08,0x20,0x80,0xC0,0x50,
+  0xC0,0x80,0x20,0xFE,0x3E,0x1F,0x0F,0x07,0x03,0x03,0x01,0x01,0xF0,0xE0,0xC0,0x80,
+  0x80,0xFE,0xF8,0x01,0x01,0x03,0x03,0x07,0x0F,0x1F,0x80,0x80,0xC0,0xE0,0xF0,0x7E,
+  0x7E,0x04,0x0C,0x1F,0x1F,0x0C,0x04,0x40,0x60,0xF0,0xF0,0x60,0x40,0xEE,0x6C,0x0E,
+  0x1F,0x1F,0x1F,0x1F,0x0E,0xB0,0xB0,0xB0,0xB0,0xFF,0xD8,0x0E,0x1F,0x11,0x1F,0x1F,
+  0x10,0x1F,0x1F,0xF0,0xF0,0xF0,0xF0,0x7E,0x7E,0x1B,0x3F,0x24,0x26,0x33,0x11,0x10,
+  0x98,0xC8,0x48,0xF8,0xB0,0x00,0xFE,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x7E,0x7E,
+  0x04,0x0C,0x1F,0x1F,0x0C,0x04,0x48,0x68,0xF8,0xF8,0x68,0x48,0x7E,0x18,0x04,0x0C,
+  0x1F,0x1F,0x0C,0x04,0xF0,0xF0,0x18,0x7E,0x1F,0x1F,0x40,0x60,0xF0,0xF0,0x60,0x40,
+  0xFE,0x60,0x01,0x01,0x01,0x01,0x07,0x03,0x01,0xC0,0x80,0xFE,0x0C,0x01,0x03,0x07,
+  0x01,0x01,0x01,0x01,0x80,0xC0,0x06,0xFE,0x03,0x03,0xC0,0xC0,0x40,0x40,0x40,0x40,
+  0x40,0xFF,0x66,0x01,0x03,0x07,0x01,0x01,0x07,0x03,0x01,0x80,0xC0,0xC0,0x80,0x38,
+  0xFE,0x03,0x1F,0x03,0x30,0xF0,0xF0,0xF0,0xF0,0xF0,0x30,0xFE,0x38,0x18,0x1E,0x1F,
+  0x1F,0x1F,0x1E,0x18,0x80,0xF0,0x80,0x00,0x00,0x3C,0x18,0x0E,0x1F,0x1F,0x0E,0xB0,
+  0xB0,0x7E,0x00,0x04,0x1C,0x18,0x04,0x1C,0x18,0xFE,0xFE,0x04,0x1F,0x1F,0x04,0x1F,
+  0x1F,0x04,0x40,0xF0,0xF0,0x40,0xF0,0xF0,0x40,0x7E,0x7E,0x06,0x0F,0x39,0x39,0x0D,
+  0x04,0x40,0x60,0x38,0x38,0xE0,0xC0,0xFE,0xFE,0x04,0x0E,0x0E,0x05,0x03,0x06,0x04,
+  0x20,0x60,0xC0,0xA0,0x70,0x70,0x20,0xFC,0xFE,0x0D,0x1F,0x13,0x1E,0x0D,0x01,0xE0,
+  0xF0,0x10,0x90,0xE0,0xF0,0x10,0x1C,0x00,0x04,0x1C,0x18,0x3C,0x3C,0x07,0x0F,0x18,
+  0x10,0xC0,0xE0,0x30,0x10,0x3C,0x3C,0x10,0x18,0x0F,0x07,0x10,0x30,0xE0,0xC0,0xFE,
+  0x7C,0x01,0x05,0x07,0x03,0x07,0x05,0x01,0x40,0xC0,0x80,0xC0,0x40,0x7E,0x18,0x01,
+  0x01,0x07,0x07,0x01,0x01,0xC0,0xC0,0x00,0x1C,0x08,0x38,0x30,0x7E,0x00,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x00,0x18,0x30,0x30,0xF0,0x1E,0x01,0x03,0x06,0x0C,0x30,0x60,
+  0xC0,0x80,0x7E,0x7E,0x0F,0x1F,0x10,0x10,0x1F,0x0F,0xE0,0xF0,0x10,0x10,0xF0,0xE0,
+  0x1C,0x3C,0x08,0x1F,0x1F,0x10,0xF0,0xF0,0x10,0x7E,0x7E,0x08,0x18,0x10,0x11,0x1F,
+  0x0E,0x30,0x70,0xD0,0x90,0x10,0x10,0x7E,0x7E,0x10,0x10,0x12,0x17,0x1D,0x18,0x20,
+  0x30,0x10,0x10,0xF0,0xE0,0x3E,0x7E,0x03,0x07,0x0C,0x1F,0x1F,0xC0,0xC0,0x40,0xF0,
+  0xF0,0x40,0x7E,0x7E,0x1E,0x1E,0x12,0x12,0x13,0x11,0x20,0x30,0x10,0x10,0xF0,0xE0,
+  0x3E,0x7E,0x07,0x0F,0x19,0x11,0x11,0xE0,0xF0,0x10,0x10,0xF0,0xE0,0x7E,0x0C,0x10,
+  0x10,0x11,0x13,0x1E,0x1C,0xF0,0xF0,0x7E,0x7E,0x0E,0x1F,0x11,0x11,0x1F,0x0E,0xE0,
+  0xF0,0x10,0x10,0xF0,0xE0,0x7E,0x7C,0x0E,0x1F,0x11,0x11,0x1F,0x0F,0x10,0x10,0x30,
+  0xE0,0xC0,0x18,0x18,0x0C,0x0C,0x60,0x60,0x18,0x1C,0x0C,0x0C,0x10,0x70,0x60,0x7E,
+  0x7C,0x01,0x03,0x06,0x0C,0x18,0x10,0x80,0xC0,0x60,0x30,0x10,0x7E,0x7E,0x02,0x02,
+  0x02,0x02,0x02,0x02,0x40,0x40,0x40,0x40,0x40,0x40,0x7E,0x3E,0x10,0x18,0x0C,0x06,
+  0x03,0x01,0x10,0x30,0x60,0xC0,0x80,0x7E,0x18,0x08,0x18,0x11,0x13,0x1E,0x0C,0xB0,
+  0xB0,0x7E,0x7E,0x0F,0x1F,0x10,0x13,0x1F,0x0F,0xE0,0xF0,0x10,0xD0,0xD0,0x80,0x7E,
+  0x7E,0x07,0x0F,0x18,0x18,0x0F,0x07,0xF0,0xF0,0x80,0x80,0xF0,0xF0,0x7E,0x7E,0x1F,
+  0x1F,0x11,0x11,0x1F,0x0E,0xF0,0xF0,0x10,0x10,0xF0,0xE0,0x7E,0x7E,0x0F,0x1F,0x10,
+  0x10,0x18,0x08,0xE0,0xF0,0x10,0x10,0x30,0x20,0x7E,0x7E,0x1F,0x1F,0x10,0x10,0x1F,
+  0x0F,0xF0,0xF0,0x10,0x10,0xF0,0xE0,0x7E,0x7E,0x1F,0x1F,0x11,0x11,0x11,0x10,0xF0,
+  0xF0,0x10,0x10,0x10,0x10,0x7E,0x06,0x1F,0x1F,0x11,0x11,0x11,0x10,0xF0,0xF0,0x7E,
+  0x7E,0x0F,0x1F,0x10,0x10,0x10,0x10,0xE0,0xF0,0x10,0x90,0xF0,0xF0,0x7E,0x66,0x1F,
+  0x1F,0x01,0x01,0x1F,0x1F,0xF0,0xF0,0xF0,0xF0,0x3C,0x3C,0x10,0x1F,0x1F,0x10,0x10,
+  0xF0,0xF0,0x10,0x60,0x7E,0x1F,0x1F,0x20,0x30,0x10,0x10,0xF0,0xE0,0x7E,0x76,0x1F,
+  0x1F,0x01,0x07,0x1E,0x18,0xF0,0xF0,0xC0,0xF0,0x30,0x06,0x7E,0x1F,0x1F,0xF0,0xF0,
+  0x10,0x10,0x10,0x10,0xFE,0xC6,0x1F,0x1F,0x0C,0x07,0x0C,0x1F,0x1F,0xF0,0xF0,0xF0,
+  0xF0,0x7E,0x76,0x1F,0x1F,0x07,0x01,0x1F,0x1F,0xF0,0xF0,0xC0,0xF0,0xF0,0x7E,0x7E,
+  0x0F,0x1F,0x10,0x10,0x1F,0x0F,0xE0,0xF0,0x10,0x10,0xF0,0xE0,0x7E,0x06,0x1F,0x1F,
+  0x11,0x11,0x1F,0x0E,0xF0,0xF0,0x7E,0x7E,0x0F,0x1F,0x10,0x10,0x1F,0x0F,0xE0,0xF0,
+  0x10,0x10,0xF8,0xE8,0x7E,0x7E,0x1F,0x1F,0x11,0x11,0x1F,0x0E,0xF0,0xF0,0x80,0xC0,
+  0x70,0x30,0x7E,0x7E,0x0E,0x1F,0x11,0x11,0x19,0x08,0x20,0x30,0x10,0x10,0xF0,0xE0,
+  0x7E,0x18,0x10,0x10,0x1F,0x1F,0x10,0x10,0xF0,0xF0,0x66,0x7E,0x1F,0x1F,0x1F,0x1F,
+  0xE0,0xF0,0x10,0x10,0xF0,0xE0,0x66,0x7E,0x1F,0x1F,0x1F,0x1F,0xC0,0xE0,0x30,0x30,
+  0xE0,0xC0,0xD6,0xFE,0x1F,0x1F,0x01,0x1F,0x1F,0xF0,0xF0,0x60,0xC0,0x60,0xF0,0xF0,
+  0x7E,0x7E,0x1C,0x1E,0x03,0x03,0x1E,0x1C,0x70,0xF0,0x80,0x80,0xF0,0x70,0x7E,0x18,
+  0x1E,0x1F,0x01,0x01,0x1F,0x1E,0xF0,0xF0,0x7E,0x7E,0x10,0x10,0x11,0x13,0x1E,0x1C,
+  0x70,0xF0,0x90,0x10,0x10,0x10,0x3C,0x3C,0x1F,0x1F,0x10,0x10,0xF0,0xF0,0x10,0x10,
+  0x1E,0xF0,0x0C,0x06,0x03,0x01,0x80,0xC0,0x60,0x30,0x3C,0x3C,0x10,0x10,0x1F,0x1F,
+  0x10,0x10,0xF0,0xF0,0x7E,0x00,0x08,0x18,0x30,0x30,0x18,0x08,0x00,0xFF,0x04,0x04,
+  0x04,0x04,0x04,0x04,0x04,0x04,0x38,0x00,0x18,0x1C,0x04,0x7C,0x7E,0x02,0x02,0x02,
+  0x03,0x01,0x60,0xF0,0x90,0x90,0xF0,0xF0,0x7E,0x7E,0x1F,0x1F,0x02,0x02,0x03,0x01,
+  0xF0,0xF0,0x10,0x10,0xF0,0xE0,0x7E,0x7E,0x01,0x03,0x02,0x02,0x03,0x01,0xE0,0xF0,
+  0x10,0x10,0x30,0x20,0x7E,0x7E,0x01,0x03,0x02,0x02,0x1F,0x1F,0xE0,0xF0,0x10,0x10,
+  0xF0,0xF0,0x7E,0x7E,0x01,0x03,0x02,0x02,0x03,0x01,0xE0,0xF0,0x50,0x50,0xD0,0xD0,
+  0x7E,0x0C,0x01,0x0F,0x1F,0x11,0x19,0x08,0xF0,0xF0,0x7E,0x7E,0x01,0x03,0x02,0x02,
+  0x03,0x01,0xE0,0xF2,0x12,0x12,0xFE,0xFC,0x7E,0x66,0x1F,0x1F,0x02,0x02,0x03,0x01,
+  0xF0,0xF0,0xF0,0xF0,0x1C,0x3C,0x02,0x1B,0x1B,0x10,0xF0,0xF0,0x10,0x70,0x7C,0x02,
+  0x1B,0x1B,0x08,0x0C,0x04,0xFC,0xF8,0x76,0x7E,0x1F,0x1F,0x01,0x03,0x02,0xF0,0xF0,
+  0xC0,0xE0,0x30,0x10,0x1C,0x3C,0x10,0x1F,0x1F,0x10,0xF0,0xF0,0x10,0xFE,0xD6,0x03,
+  0x03,0x03,0x01,0x03,0x03,0x01,0xF0,0xF0,0xE0,0xF0,0xF0,0x7E,0x66,0x03,0x03,0x02,
+  0x02,0x03,0x01,0xF0,0xF0,0xF0,0xF0,0x7E,0x7E,0x01,0x03,0x02,0x02,0x03,0x01,0xE0,
+  0xF0,0x10,0x10,0xF0,0xE0,0x7E,0x7E,0x03,0x03,0x02,0x02,0x03,0x01,0xFE,0xFE,0x10,
+  0x10,0xF0,0xE0,0x7E,0x7E,0x01,0x03,0x02,0x02,0x03,0x03,0xE0,0xF0,0x10,0x10,0xFE,
+  0xFE,0x7E,0x0E,0x03,0x03,0x01,0x03,0x02,0x02,0xF0,0xF0,0x80,0x7E,0x7E,0x01,0x03,
+  0x02,0x02,0x02,0x02,0x10,0x90,0x90,0x90,0xF0,0x60,0x3E,0x7C,0x02,0x1F,0x1F,0x02,
+  0x02,0xE0,0xF0,0x10,0x30,0x20,0x66,0x7E,0x03,0x03,0x03,0x03,0xE0,0xF0,0x10,0x10,
+  0xF0,0xF0,0x66,0x7E,0x03,0x03,0x03,0x03,0xC0,0xE0,0x30,0x30,0xE0,0xC0,0xC6,0xFE,
+  0x03,0x03,0x03,0x03,0xE0,0xF0,0x30,0xE0,0x30,0xF0,0xE0,0xEE,0xFE,0x02,0x03,0x01,
+  0x01,0x03,0x02,0x10,0x30,0xE0,0xC0,0xE0,0x30,0x10,0x66,0x7E,0x03,0x03,0x03,0x03,
+  0xE0,0xF2,0x12,0x12,0xFE,0xFC,0x7E,0x7E,0x02,0x02,0x02,0x03,0x03,0x02,0x30,0x70,
+  0xD0,0x90,0x10,0x10,0x7C,0x78,0x01,0x0F,0x1E,0x10,0x10,0xE0,0xF0,0x10,0x10,0x18,
+  0x18,0x1E,0x1E,0xF0,0xF0,0x7C,0x3C,0x10,0x10,0x1E,0x0F,0x01,0x10,0x10,0xF0,0xE0,
+  0xFE,0x00,0x01,0x03,0x02,0x03,0x01,0x03,0x02,0xF8,0x00,0x0E,0x11,0x11,0x11,0x0E,
+};
+
+#endif // PACKED_FONT_DATA_H
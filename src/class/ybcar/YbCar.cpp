@@ -61,6 +61,7 @@ void YbCar::updateDisplay() {
     pLcd->showMotorTemp(vehicleData.motorTemp);
     pLcd->showMotorCurrent(vehicleData.motorCurrent);
     pLcd->showFetTemp(vehicleData.fetTemp);
+    pLcd->addTrendSample(vehicleData.motorTemp, vehicleData.fetTemp, vehicleData.motorCurrent);
 }
 
 bool YbCar::isConnected() const {
@@ -5,7 +5,8 @@
 
 Preferences preferences;
 
-YbCarDoctor::YbCarDoctor() {
+YbCarDoctor::YbCarDoctor()
+    : settingsMenu(30, 8, 25) {
     pLcd = nullptr;
     pEspNow = nullptr;
     settingsReceived = false;
@@ -332,72 +333,112 @@ bool YbCarDoctor::loadSettings() {
 void YbCarDoctor::displaySettings() {
     if (!pLcd) return;
     
-    pLcd->clear();
-    pLcd->setTextSize(2);
-    pLcd->printTextCentered("차량 설정", 5, RemoteLCD::CYAN);
+    static constexpr auto TEXT_TITLE = LCD_TEXT("차량 설정");
+    static constexpr auto TEXT_BATTERY = LCD_TEXT("배터리");
+    static constexpr auto TEXT_CURRENT = LCD_TEXT("최대전류");
+    static constexpr auto TEXT_MOTOR_TEMP = LCD_TEXT("모터온도");
+    static constexpr auto TEXT_FET_TEMP = LCD_TEXT("FET온도");
+    static constexpr auto TEXT_LOW_BATTERY = LCD_TEXT("저전압");
+    static constexpr auto TEXT_TYPE = LCD_TEXT("타입");
+    static constexpr auto TEXT_POLARITY = LCD_TEXT("극성");
+    static constexpr auto TEXT_THROTTLE = LCD_TEXT("스로틀");
+    static constexpr auto TEXT_DRIVE = LCD_TEXT("전진/후진");
+    static constexpr auto TEXT_ACCEL = LCD_TEXT("가속/감속");
+    static constexpr auto TEXT_BRAKE = LCD_TEXT("브레이크");
+    
+    // 줄 y = SETTINGS_ROW_Y + 줄 번호 * SETTINGS_ROW_PITCH
+    static constexpr LcdPageItem ITEMS[] = {
+        LcdPageItem::centered(TEXT_TITLE, 5, RemoteLCD::CYAN),
+        LcdPageItem::label(TEXT_BATTERY, 10, 28, RemoteLCD::WHITE),
+        LcdPageItem::label(TEXT_CURRENT, 10, 46, RemoteLCD::WHITE),
+        LcdPageItem::label(TEXT_MOTOR_TEMP, 10, 64, RemoteLCD::YELLOW),
+        LcdPageItem::label(TEXT_FET_TEMP, 10, 82, RemoteLCD::YELLOW),
+        LcdPageItem::label(TEXT_LOW_BATTERY, 10, 100, RemoteLCD::RED),
+        LcdPageItem::label(TEXT_TYPE, 10, 118, RemoteLCD::CYAN),
+        LcdPageItem::label(TEXT_POLARITY, 10, 136, RemoteLCD::MAGENTA),
+        LcdPageItem::label(TEXT_THROTTLE, 10, 154, RemoteLCD::WHITE),
+        LcdPageItem::label(TEXT_DRIVE, 10, 172, RemoteLCD::GREEN),
+        LcdPageItem::label(TEXT_ACCEL, 10, 190, RemoteLCD::YELLOW),
+        LcdPageItem::label(TEXT_BRAKE, 10, 208, RemoteLCD::RED),
+    };
+    static constexpr LcdPageLayout LAYOUT = { ITEMS, sizeof(ITEMS) / sizeof(ITEMS[0]) };
+    
+    // 이미 설정 화면이면 라벨은 그대로 두고 값만 덮어씀
+    pLcd->beginPage(RemoteLCD::PAGE_SETTINGS, LAYOUT);
     
-    pLcd->setTextSize(1);
-    char text[35];
+    char text[40];
     
     // 배터리 & 전류
-    sprintf(text, "배터리: %dV", currentSettings.batteryVoltage / 100);
-    pLcd->printText(text, 10, 30, RemoteLCD::WHITE);
+    sprintf(text, "%dV", currentSettings.batteryVoltage / 100);
+    drawSettingValue(0, text, RemoteLCD::WHITE);
     
-    sprintf(text, "최대전류: %dA", currentSettings.limitCurrent / 100);
-    pLcd->printText(text, 10, 45, RemoteLCD::WHITE);
+    sprintf(text, "%dA", currentSettings.limitCurrent / 100);
+    drawSettingValue(1, text, RemoteLCD::WHITE);
     
     // 온도 제한
-    sprintf(text, "모터온도: %dC", currentSettings.limitMotorTemp);
-    pLcd->printText(text, 10, 60, RemoteLCD::YELLOW);
+    sprintf(text, "%d°C", currentSettings.limitMotorTemp);
+    drawSettingValue(2, text, RemoteLCD::YELLOW);
     
-    sprintf(text, "FET온도: %dC", currentSettings.limitFetTemp);
-    pLcd->printText(text, 10, 75, RemoteLCD::YELLOW);
+    sprintf(text, "%d°C", currentSettings.limitFetTemp);
+    drawSettingValue(3, text, RemoteLCD::YELLOW);
     
     // 저전압
-    sprintf(text, "저전압: %dV", currentSettings.lowBattery / 100);
-    pLcd->printText(text, 10, 90, RemoteLCD::RED);
+    sprintf(text, "%dV", currentSettings.lowBattery / 100);
+    drawSettingValue(4, text, RemoteLCD::RED);
     
     // 바퀴타입
-    sprintf(text, "타입: %s", currentSettings.barityIm ? "바퀴" : "무한궤도");
-    pLcd->printText(text, 10, 105, RemoteLCD::CYAN);
+    drawSettingValue(5, currentSettings.barityIm ? "바퀴" : "무한궤도", RemoteLCD::CYAN);
     
     // 모터 극성
     sprintf(text, "M1:%s M2:%s", 
             currentSettings.motor1Polarity ? "역" : "정",
             currentSettings.motor2Polarity ? "역" : "정");
-    pLcd->printText(text, 10, 120, RemoteLCD::MAGENTA);
+    drawSettingValue(6, text, RemoteLCD::MAGENTA);
     
     // 스로틀
-    sprintf(text, "스로틀 Ofs:%d Inf:%d", 
+    sprintf(text, "Ofs:%d Inf:%d", 
             currentSettings.throttleOffset, currentSettings.throttleInflec);
-    pLcd->printText(text, 10, 135, RemoteLCD::WHITE);
+    drawSettingValue(7, text, RemoteLCD::WHITE);
     
     // 전후진
-    sprintf(text, "전진:%d%% 후진:%d%%", 
+    sprintf(text, "%d%% / %d%%", 
             currentSettings.forward, currentSettings.backward);
-    pLcd->printText(text, 10, 150, RemoteLCD::GREEN);
+    drawSettingValue(8, text, RemoteLCD::GREEN);
     
     // 가감속
-    sprintf(text, "가속:%d 감속:%d", 
+    sprintf(text, "%d / %d", 
             currentSettings.accel, currentSettings.decel);
-    pLcd->printText(text, 10, 165, RemoteLCD::YELLOW);
+    drawSettingValue(9, text, RemoteLCD::YELLOW);
     
     // 브레이크
-    sprintf(text, "브레이크 Dly:%d Rate:%d", 
+    sprintf(text, "Dly:%d Rate:%d", 
             currentSettings.brakeDelay, currentSettings.brakeRate);
-    pLcd->printText(text, 10, 180, RemoteLCD::RED);
+    drawSettingValue(10, text, RemoteLCD::RED);
+    
+    pLcd->endPage();
+}
+
+// 값 칸: 배경색으로 덮어쓰고 남은 폭만 지움 (화면 전체 지우기 없음)
+void YbCarDoctor::drawSettingValue(uint8_t row, const char* text, uint16_t color) {
+    int16_t y = SETTINGS_ROW_Y + row * SETTINGS_ROW_PITCH;
+    int w = pLcd->drawString(text, SETTINGS_VALUE_X, y, { color, 1, lcdtext::ALIGN_LEFT, true, RemoteLCD::BLACK });
+    
+    int16_t x = SETTINGS_VALUE_X + w;
+    if (x < RemoteLCD::SCREEN_WIDTH) {
+        pLcd->fillRect16(x, y, RemoteLCD::SCREEN_WIDTH - x, 16, RemoteLCD::BLACK);
+    }
 }
 
 void YbCarDoctor::displaySettingsMenu(uint8_t selectedIndex) {
     if (!pLcd) return;
     
-    pLcd->clear();
-    pLcd->setTextSize(2);
-    pLcd->printTextCentered("설정 메뉴", 5, RemoteLCD::CYAN);
-    
-    pLcd->setTextSize(1);
+    static constexpr auto TEXT_TITLE = LCD_TEXT("설정 메뉴");
+    static constexpr LcdPageItem ITEMS[] = {
+        LcdPageItem::centered(TEXT_TITLE, 5, RemoteLCD::CYAN),
+    };
+    static constexpr LcdPageLayout LAYOUT = { ITEMS, sizeof(ITEMS) / sizeof(ITEMS[0]) };
     
-    const char* menuItems[] = {
+    static const char* const MENU_ITEMS[] = {
         "1. 최대속도",
         "2. 최대전류",
         "3. 가속도",
@@ -408,16 +449,12 @@ void YbCarDoctor::displaySettingsMenu(uint8_t selectedIndex) {
         "8. 시스템"
     };
     
-    for (uint8_t i = 0; i < 8; i++) {
-        uint16_t color = (i == selectedIndex) ? RemoteLCD::YELLOW : RemoteLCD::WHITE;
-        uint16_t yPos = 30 + (i * 25);
-        
-        if (i == selectedIndex) {
-            pLcd->printText(">", 5, yPos, RemoteLCD::GREEN);
-        }
-        
-        pLcd->printText(menuItems[i], 20, yPos, color);
+    // 페이지에 새로 들어왔을 때만 전체, 이후 선택 이동은 이전/새 선택 줄만
+    if (pLcd->beginPage(RemoteLCD::PAGE_SETTINGS_MENU, LAYOUT)) {
+        settingsMenu.setItems(MENU_ITEMS, sizeof(MENU_ITEMS) / sizeof(MENU_ITEMS[0]));
     }
+    pLcd->drawMenu(settingsMenu, selectedIndex);
+    pLcd->endPage();
 }
 
 // CAN 버퍼에서 설정 로드 (64바이트 데이터 파싱)
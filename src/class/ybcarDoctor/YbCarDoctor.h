@@ -2,6 +2,7 @@
 #define YBCAR_DOCTOR_H
 
 #include <Arduino.h>
+#include "../lcd/LcdMenu.h"
 
 // Forward declarations
 class RemoteLCD;
@@ -125,7 +126,14 @@ private:
     unsigned long lastUpdateTime;
     unsigned long lastRequestTime;
     
+    // 설정 화면 배치 (라벨은 정적 레이어, 값만 다시 그림)
+    static const int16_t SETTINGS_ROW_Y = 28;
+    static const int16_t SETTINGS_ROW_PITCH = 18;
+    static const int16_t SETTINGS_VALUE_X = 90;
+    LcdMenu settingsMenu;       // 설정 메뉴 선택 상태 (바뀐 줄만 다시 그림)
+    
     // 내부 함수
+    void drawSettingValue(uint8_t row, const char* text, uint16_t color);
     uint32_t calculateChecksum(const VehicleSettings& settings);
     bool verifyChecksum(const settings_message* msg);
     void initializeDefaultSettings();
@@ -65,6 +65,9 @@ void setup() {
   Serial.begin(115200);
   delay(100);
   
+  // printf 출력을 LCD 진단 콘솔에도 (ESP-NOW 등 태스크 생성 전에)
+  lcd.getConsole().teeStdout();
+  
   printf("\r\n=== ESP32 리모컨 시작 ===\r\n");
   
   // LED 초기화
@@ -73,17 +76,22 @@ void setup() {
   // LCD 초기화
   printf("LCD 초기화 중...\r\n");
   if (lcd.begin()) {
+    lcd.setFrameRate(20);  // 위젯 갱신은 20Hz 프레임으로 모아서 그림
     lcd.drawMainScreen();
     printf("LCD 초기화 성공\r\n");
   } else {
     printf("LCD 초기화 실패!\r\n");
   }
   
+  // 부팅 알림은 머리 줄 알림으로 (메인 화면 위젯/추세 그래프 스크롤 영역에 남지 않도록), 전체 기록은 진단 콘솔
+  bool bootError = false;
+  
   // 버튼 초기화 (12512WS-08 5버튼)
   printf("버튼 초기화 중...\r\n");
   if (!buttons.begin()) {
     printf("버튼 초기화 실패!\r\n");
-    lcd.printTextCentered("버튼 초기화 실패!", 150, RemoteLCD::RED);
+    lcd.showToast("버튼 초기화 실패!", RemoteLCD::RED, 5000);
+    bootError = true;
   } else {
     printf("5개 버튼 준비 완료\r\n");
   }
@@ -92,11 +100,10 @@ void setup() {
   printf("CAN 통신 초기화 중...\r\n");
   if (!canCom.begin(GPIO_NUM_21, GPIO_NUM_22)) {  // TX=GPIO21, RX=GPIO22
     printf("CAN 초기화 실패!\r\n");
-    lcd.printTextCentered("CAN 초기화 실패", 170, RemoteLCD::YELLOW);
+    lcd.showToast("CAN 초기화 실패", RemoteLCD::YELLOW, 5000);
+    bootError = true;
   } else {
-    printf("ESP32 내장 CAN 준비 완료\r\n");
-    lcd.setTextSize(1);
-    lcd.printText("CAN: 500kbps", 200, 220, RemoteLCD::CYAN);
+    printf("ESP32 내장 CAN 준비 완료 (500kbps)\r\n");
   }
   
   // 핸들러 설정
@@ -107,14 +114,16 @@ void setup() {
   printf("ESP-NOW 초기화 중...\r\n");
   if (!espNow.begin()) {
     printf("ESP-NOW 초기화 실패!\r\n");
-    lcd.printTextCentered("ESP-NOW 초기화 실패!", 185, RemoteLCD::RED);
+    lcd.showToast("ESP-NOW 초기화 실패!", RemoteLCD::RED, 5000);
     return;
   }
   
-  // LCD에 MAC 주소 표시
-  lcd.setTextSize(1);
+  // LCD에 MAC 주소 표시 (앞의 실패 알림이 있으면 그대로 둠)
   String macStr = "MAC: " + espNow.getMacAddress();
-  lcd.printText(macStr.c_str(), 10, 220, RemoteLCD::YELLOW);
+  printf("%s\r\n", macStr.c_str());
+  if (!bootError) {
+    lcd.showToast(macStr.c_str(), RemoteLCD::YELLOW, 5000);
+  }
   
   // 콜백 설정
   espNow.setSendCallback(onSendComplete);
@@ -139,6 +148,8 @@ void setup() {
   printf("차량 데이터 수신 대기 중...\r\n");
   
   lcd.showConnectionStatus(true);
+  lcd.flush();  // loop() 전에 화면 반영 (컴포지터 대기 값, 프레임버퍼)
+  lcd.printFrameBufferStats();
   
   // 차량 설정 요청 (5초 후)
   delay(5000);
@@ -162,5 +173,8 @@ void loop() {
   // CAN 통신 업데이트 (메시지 수신 처리)
   canCom.update();
   
+  // LCD 프레임 갱신 (대기 중인 위젯 값 그리기)
+  lcd.update();
+  
   delay(10); // CPU 부하 감소
 }
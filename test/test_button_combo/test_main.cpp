@@ -0,0 +1,147 @@
+// ButtonComboEngine 호스트 단위 테스트: pio test -e native -f test_button_combo
+#include <unity.h>
+#include "class/button/ButtonCombo.h"
+
+// RemoteButton 과 같은 버튼 번호
+static const uint8_t SELECT = 0;
+static const uint8_t DOWN = 1;
+static const uint8_t RIGHT = 2;
+static const uint8_t LEFT = 3;
+static const uint8_t UP = 4;
+
+static const uint8_t ACTION_SETTINGS = 1;
+static const uint8_t ACTION_STATS = 2;
+
+static constexpr ButtonCombo TABLE[] = {
+    ButtonCombo::chord(ACTION_SETTINGS, (1 << SELECT) | (1 << LEFT) | (1 << RIGHT), 1000),
+    ButtonCombo::sequence(ACTION_STATS, 600, UP, UP, DOWN),
+};
+
+static const int64_t MS = 1000;
+
+// RemoteButton 처럼 눌림 상태 마스크를 들고 엔진 호출
+struct Pad {
+    ButtonComboEngine engine;
+    uint8_t mask = 0;
+
+    Pad() { engine.setTable(TABLE, sizeof(TABLE) / sizeof(TABLE[0])); }
+
+    uint8_t press(uint8_t id, int64_t t) {
+        mask |= 1 << id;
+        return engine.onPress(id, mask, t);
+    }
+    bool release(uint8_t id) {
+        mask &= ~(1 << id);
+        return engine.onRelease(id);
+    }
+    uint8_t update(int64_t t) { return engine.update(mask, t); }
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_chord_fires_after_hold() {
+    Pad pad;
+    TEST_ASSERT_EQUAL_UINT8(0, pad.press(SELECT, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, pad.press(LEFT, 50 * MS));
+    TEST_ASSERT_EQUAL_UINT8(0, pad.press(RIGHT, 100 * MS));
+    TEST_ASSERT_TRUE(pad.engine.isHeldBack(RIGHT));
+    TEST_ASSERT_TRUE(pad.engine.isInCombo(SELECT));
+
+    TEST_ASSERT_EQUAL_UINT8(0, pad.update(1000 * MS));
+    TEST_ASSERT_EQUAL_UINT8(ACTION_SETTINGS, pad.update(1100 * MS));
+    TEST_ASSERT_EQUAL_UINT8(0, pad.update(1500 * MS));     // 누르는 동안 한 번
+
+    // 완성한 누름의 릴리스는 감추고, 먼저 보낸 누름의 릴리스는 그대로
+    TEST_ASSERT_FALSE(pad.release(SELECT));
+    TEST_ASSERT_TRUE(pad.release(RIGHT));
+    TEST_ASSERT_FALSE(pad.release(LEFT));
+    TEST_ASSERT_EQUAL_HEX8(0, pad.engine.takeForwarded());
+    TEST_ASSERT_EQUAL_UINT32(1, pad.engine.getMatches());
+}
+
+// 셋 다 짧게 눌렀다 놓음: 조합 없음, RIGHT 눌림/릴리스는 돌려받아야 함
+void test_aborted_chord_forwards_held_press() {
+    Pad pad;
+    pad.press(SELECT, 0);
+    pad.press(LEFT, 20 * MS);
+    pad.press(RIGHT, 40 * MS);
+    TEST_ASSERT_EQUAL_UINT8(0, pad.update(50 * MS));
+    TEST_ASSERT_TRUE(pad.engine.isHeldBack(RIGHT));
+
+    // 감춘 버튼 자신이 먼저 놓임 → 감춤 해제, 릴리스도 내보냄
+    TEST_ASSERT_FALSE(pad.release(RIGHT));
+    TEST_ASSERT_EQUAL_HEX8(1 << RIGHT, pad.engine.takeForwarded());
+    TEST_ASSERT_EQUAL_HEX8(0, pad.engine.takeForwarded());     // 읽으면 비움
+    TEST_ASSERT_FALSE(pad.engine.isHeldBack(RIGHT));
+
+    TEST_ASSERT_FALSE(pad.release(SELECT));
+    TEST_ASSERT_FALSE(pad.release(LEFT));
+    TEST_ASSERT_EQUAL_UINT8(0, pad.update(2000 * MS));
+    TEST_ASSERT_EQUAL_UINT32(0, pad.engine.getMatches());
+}
+
+// 다른 버튼이 먼저 놓임 → 감춘 누름을 그때 돌려주고 나중 릴리스는 그대로
+void test_aborted_chord_member_released_first() {
+    Pad pad;
+    pad.press(SELECT, 0);
+    pad.press(LEFT, 20 * MS);
+    pad.press(RIGHT, 40 * MS);
+    pad.update(300 * MS);
+
+    TEST_ASSERT_FALSE(pad.release(LEFT));
+    TEST_ASSERT_EQUAL_HEX8(1 << RIGHT, pad.engine.takeForwarded());
+    TEST_ASSERT_FALSE(pad.engine.isInCombo(RIGHT));
+
+    TEST_ASSERT_EQUAL_UINT8(0, pad.update(1500 * MS));     // 유지 시간이 지나도 조합 아님
+    TEST_ASSERT_FALSE(pad.release(RIGHT));
+    TEST_ASSERT_FALSE(pad.release(SELECT));
+    TEST_ASSERT_EQUAL_HEX8(0, pad.engine.takeForwarded());
+}
+
+// update() 에서 먼저 풀림을 본 경우 (릴리스가 같은 scan 에서 나중에 처리될 때)
+void test_aborted_chord_seen_by_update() {
+    Pad pad;
+    pad.press(SELECT, 0);
+    pad.press(LEFT, 20 * MS);
+    pad.press(RIGHT, 40 * MS);
+
+    pad.mask &= ~(1 << SELECT);
+    TEST_ASSERT_EQUAL_UINT8(0, pad.update(200 * MS));
+    TEST_ASSERT_EQUAL_HEX8(1 << RIGHT, pad.engine.takeForwarded());
+    TEST_ASSERT_FALSE(pad.engine.onRelease(SELECT));
+    TEST_ASSERT_FALSE(pad.release(RIGHT));
+}
+
+void test_sequence_holds_completing_press() {
+    Pad pad;
+    TEST_ASSERT_EQUAL_UINT8(0, pad.press(UP, 0));
+    TEST_ASSERT_FALSE(pad.release(UP));
+    TEST_ASSERT_EQUAL_UINT8(0, pad.press(UP, 200 * MS));
+    TEST_ASSERT_FALSE(pad.release(UP));
+    TEST_ASSERT_EQUAL_UINT8(ACTION_STATS, pad.press(DOWN, 400 * MS));
+    TEST_ASSERT_TRUE(pad.engine.isHeldBack(DOWN));
+    TEST_ASSERT_TRUE(pad.release(DOWN));
+}
+
+void test_sequence_gap_too_long() {
+    Pad pad;
+    pad.press(UP, 0);
+    pad.release(UP);
+    pad.press(UP, 200 * MS);
+    pad.release(UP);
+    TEST_ASSERT_EQUAL_UINT8(0, pad.press(DOWN, 1100 * MS));
+    TEST_ASSERT_FALSE(pad.engine.isHeldBack(DOWN));
+    TEST_ASSERT_FALSE(pad.release(DOWN));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_chord_fires_after_hold);
+    RUN_TEST(test_aborted_chord_forwards_held_press);
+    RUN_TEST(test_aborted_chord_member_released_first);
+    RUN_TEST(test_aborted_chord_seen_by_update);
+    RUN_TEST(test_sequence_holds_completing_press);
+    RUN_TEST(test_sequence_gap_too_long);
+    return UNITY_END();
+}
@@ -0,0 +1,130 @@
+// ButtonGesture 호스트 단위 테스트: pio test -e native -f test_button_gesture
+#include <unity.h>
+#include "class/button/ButtonGesture.h"
+
+// RemoteButton 기본값과 같은 시간 (ms)
+static const ButtonGesture::Timing TIMING = { 300, 1000, 400, 150, 30 };
+
+static int64_t ms(int64_t v) { return v * 1000; }
+
+void setUp() {}
+void tearDown() {}
+
+void test_click_after_double_click_window() {
+    ButtonGesture g;
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.onPress(ms(0), TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(50), false, TIMING));
+    g.onRelease(ms(100));
+    
+    // 놓은 뒤 300ms 까지는 대기, 넘으면 CLICK 한 번
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(250), false, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(400), false, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::CLICK, g.update(ms(401), false, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(2000), false, TIMING));
+}
+
+void test_double_click_at_second_press() {
+    ButtonGesture g;
+    g.onPress(ms(0), TIMING);
+    g.onRelease(ms(80));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(200), false, TIMING));
+    
+    // 두 번째 누름 즉시 (놓기를 기다리지 않음)
+    TEST_ASSERT_EQUAL(ButtonGesture::DOUBLE_CLICK, g.onPress(ms(250), TIMING));
+    g.onRelease(ms(320));
+    
+    // 두 번째 누름은 클릭이 아님
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(1000), false, TIMING));
+}
+
+// loop 가 멈춘 뒤 에지를 한꺼번에 처리: 실제 간격(500ms)은 더블클릭 시간 밖 → CLICK 두 번
+void test_late_drained_slow_clicks() {
+    ButtonGesture g;
+    g.onPress(ms(0), TIMING);
+    g.onRelease(ms(100));
+    TEST_ASSERT_EQUAL(ButtonGesture::CLICK, g.onPress(ms(600), TIMING));
+    g.onRelease(ms(700));
+    
+    TEST_ASSERT_EQUAL(ButtonGesture::CLICK, g.update(ms(1200), false, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(1300), false, TIMING));
+}
+
+void test_long_press_once_across_stalls() {
+    ButtonGesture g;
+    g.onPress(ms(0), TIMING);
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(500), false, TIMING));
+    
+    // 롱프레스 시간을 한참 넘겨서야 update (loop 정지)
+    TEST_ASSERT_EQUAL(ButtonGesture::LONG_PRESS, g.update(ms(1800), false, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(3500), false, TIMING));
+    TEST_ASSERT_TRUE(g.isHeld());
+    
+    // 롱프레스 뒤 놓음은 클릭이 아님
+    g.onRelease(ms(4000));
+    TEST_ASSERT_FALSE(g.isHeld());
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(5000), false, TIMING));
+}
+
+// 400ms 지연, 150ms 부터 반복마다 3/4, 최소 30ms
+void test_repeat_schedule() {
+    static const int64_t EXPECT_US[] = {
+        400000, 550000, 662500, 746875, 810156, 857616, 893211, 923211, 953211
+    };
+    ButtonGesture g;
+    g.onPress(0, TIMING);
+    
+    for (uint8_t i = 0; i < sizeof(EXPECT_US) / sizeof(EXPECT_US[0]); i++) {
+        TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(EXPECT_US[i] - 1, true, TIMING));
+        TEST_ASSERT_EQUAL(ButtonGesture::REPEAT, g.update(EXPECT_US[i], true, TIMING));
+        TEST_ASSERT_EQUAL_UINT16(i + 1, g.getRepeatCount());
+    }
+    
+    // 반복 대상이면 롱프레스 없음, 반복 뒤 놓음은 클릭이 아님
+    g.onRelease(ms(1100));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(2000), true, TIMING));
+}
+
+// loop 가 멈췄다 돌아오면 밀린 반복을 몰아서 내지 않고 한 번 + 지금부터 다시 예약
+void test_repeat_rescheduled_after_stall() {
+    ButtonGesture g;
+    g.onPress(0, TIMING);
+    TEST_ASSERT_EQUAL(ButtonGesture::REPEAT, g.update(ms(400), true, TIMING));
+    
+    // 550ms 예정이던 두 번째 반복을 1500ms 에 한 번, 다음은 그때부터 112.5ms (150 x 3/4) 뒤
+    TEST_ASSERT_EQUAL(ButtonGesture::REPEAT, g.update(ms(1500), true, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(1500), true, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(1612499, true, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::REPEAT, g.update(1612500, true, TIMING));
+    TEST_ASSERT_EQUAL_UINT16(3, g.getRepeatCount());
+}
+
+void test_cancel() {
+    // 반복 중 취소: 더 반복하지 않고 놓아도 클릭 없음
+    ButtonGesture g;
+    g.onPress(0, TIMING);
+    TEST_ASSERT_EQUAL(ButtonGesture::REPEAT, g.update(ms(400), true, TIMING));
+    g.cancel();
+    TEST_ASSERT_FALSE(g.isHeld());
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(600), true, TIMING));
+    g.onRelease(ms(700));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(1500), true, TIMING));
+    
+    // 클릭 대기 중 취소: CLICK 없음, 다음 누름은 새 첫 누름
+    g.onPress(ms(2000), TIMING);
+    g.onRelease(ms(2100));
+    g.cancel();
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.update(ms(3000), false, TIMING));
+    TEST_ASSERT_EQUAL(ButtonGesture::NONE, g.onPress(ms(3100), TIMING));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_click_after_double_click_window);
+    RUN_TEST(test_double_click_at_second_press);
+    RUN_TEST(test_late_drained_slow_clicks);
+    RUN_TEST(test_long_press_once_across_stalls);
+    RUN_TEST(test_repeat_schedule);
+    RUN_TEST(test_repeat_rescheduled_after_stall);
+    RUN_TEST(test_cancel);
+    return UNITY_END();
+}
@@ -0,0 +1,159 @@
+// DiagConsole 호스트 단위 테스트: pio test -e native -f test_diag_console
+#include <unity.h>
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+#include "class/lcd/DiagConsole.h"
+
+void setUp() {}
+void tearDown() {}
+
+// 쓰는 쪽 번호와 줄 번호로 내용을 정함 (찢어진 줄이면 꼬리가 맞지 않음)
+static int makeLine(char* out, int writer, uint32_t n) {
+    int len = snprintf(out, DiagConsole::LINE_BYTES, "w%d %u ", writer, n);
+    int fill = 10 + n % 40;
+    for (int i = 0; i < fill; i++) out[len++] = 'a' + (n + writer + i) % 26;
+    out[len] = '\0';
+    return len;
+}
+
+static bool checkLine(const char* text, int& writer, uint32_t& n) {
+    if (sscanf(text, "w%d %u ", &writer, &n) != 2) return false;
+    char expect[DiagConsole::LINE_BYTES];
+    makeLine(expect, writer, n);
+    return strcmp(expect, text) == 0;
+}
+
+static size_t utf8Length(const char* text) {
+    size_t count = 0;
+    for (const char* p = text; *p; p++) {
+        if (((uint8_t)*p & 0xC0) != 0x80) count++;
+    }
+    return count;
+}
+
+void test_read_in_order() {
+    DiagConsole console;
+    char text[DiagConsole::LINE_BYTES];
+    uint32_t next = 0;
+    
+    TEST_ASSERT_FALSE(console.read(next, text));
+    console.print("첫 줄\r\n\r\n둘째 줄\n");
+    TEST_ASSERT_EQUAL_UINT32(2, console.getHead());
+    TEST_ASSERT_TRUE(console.read(next, text));
+    TEST_ASSERT_EQUAL_STRING("첫 줄", text);
+    TEST_ASSERT_TRUE(console.read(next, text));
+    TEST_ASSERT_EQUAL_STRING("둘째 줄", text);
+    TEST_ASSERT_FALSE(console.read(next, text));
+}
+
+void test_lapped_reader_counts_dropped() {
+    DiagConsole console;
+    char text[DiagConsole::LINE_BYTES];
+    uint32_t next = 0;
+    
+    for (int i = 1; i <= DiagConsole::LINES + 5; i++) console.print("%d", i);
+    
+    TEST_ASSERT_TRUE(console.read(next, text));
+    TEST_ASSERT_EQUAL_STRING("6", text);
+    TEST_ASSERT_EQUAL_UINT32(5, console.getDropped());
+}
+
+// 91바이트 한글 줄: 63바이트에서 끊으면 '가' 중간 → 61바이트 (a + 가 20개)
+void test_long_line_cut_at_character() {
+    DiagConsole console;
+    char line[128] = "a";
+    for (int i = 0; i < 30; i++) strcat(line, "가");
+    console.append(line, strlen(line));
+    
+    char text[DiagConsole::LINE_BYTES];
+    uint32_t next = 0;
+    TEST_ASSERT_TRUE(console.read(next, text));
+    TEST_ASSERT_EQUAL_UINT32(61, strlen(text));
+    TEST_ASSERT_EQUAL_UINT32(21, utf8Length(text));
+}
+
+// printf 가로채기가 63바이트로 자른 줄 (끝이 '가' 의 앞 2바이트)
+void test_tee_capped_line_trimmed() {
+    DiagConsole console;
+    char line[128] = "a";
+    for (int i = 0; i < 21; i++) strcat(line, "가");
+    console.append(line, DiagConsole::LINE_BYTES - 1);
+    
+    // 끝 글자가 온전하면 그대로 (2 + 3 x 20 = 62바이트)
+    char whole[128] = "ab";
+    for (int i = 0; i < 20; i++) strcat(whole, "가");
+    console.append(whole, strlen(whole));
+    
+    char text[DiagConsole::LINE_BYTES];
+    uint32_t next = 0;
+    TEST_ASSERT_TRUE(console.read(next, text));
+    TEST_ASSERT_EQUAL_UINT32(61, strlen(text));
+    TEST_ASSERT_TRUE(console.read(next, text));
+    TEST_ASSERT_EQUAL_STRING(whole, text);
+}
+
+// 쓰는 스레드 4개 + 읽는 스레드 1개: 찢어진 줄 없음, 쓰는 쪽별 순서 유지, 읽음 + dropped = 전체
+void test_many_writers_one_reader() {
+    static DiagConsole console;
+    const int WRITERS = 4;
+    const uint32_t PER_WRITER = 20000;
+    std::atomic<int> running(WRITERS);
+    
+    uint32_t readCount = 0;
+    uint32_t torn = 0;
+    uint32_t disorder = 0;
+    std::thread reader([&] {
+        char text[DiagConsole::LINE_BYTES];
+        uint32_t next = 0;
+        uint32_t lastSeen[WRITERS] = {};
+        while (true) {
+            bool done = running.load() == 0;
+            if (console.read(next, text)) {
+                int writer;
+                uint32_t n;
+                if (!checkLine(text, writer, n) || writer < 0 || writer >= WRITERS) {
+                    torn++;
+                    continue;
+                }
+                if (n <= lastSeen[writer]) disorder++;
+                lastSeen[writer] = n;
+                readCount++;
+            } else if (done && next > console.getHead()) {
+                break;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    
+    std::thread writers[WRITERS];
+    for (int w = 0; w < WRITERS; w++) {
+        writers[w] = std::thread([&, w] {
+            char line[DiagConsole::LINE_BYTES];
+            for (uint32_t n = 1; n <= PER_WRITER; n++) {
+                int len = makeLine(line, w, n);
+                console.append(line, len);
+            }
+            running--;
+        });
+    }
+    for (int w = 0; w < WRITERS; w++) writers[w].join();
+    reader.join();
+    
+    TEST_ASSERT_EQUAL_UINT32(WRITERS * PER_WRITER, console.getHead());
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+    TEST_ASSERT_EQUAL_UINT32(0, disorder);
+    TEST_ASSERT_EQUAL_UINT32(WRITERS * PER_WRITER, readCount + console.getDropped());
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_read_in_order);
+    RUN_TEST(test_lapped_reader_counts_dropped);
+    RUN_TEST(test_long_line_cut_at_character);
+    RUN_TEST(test_tee_capped_line_trimmed);
+    RUN_TEST(test_many_writers_one_reader);
+    return UNITY_END();
+}
@@ -0,0 +1,170 @@
+// FontPartition 호스트 단위 테스트 (POSIX mmap 경로): pio test -e native -f test_font_partition
+// - 작은 LFNT 이미지를 tools/build_font_partition.py 와 같은 배치로 만들어 begin(path) 로 매핑
+// - python3 가 있으면 생성기 출력 전체를 매핑해 완성형 한글이 런타임 조합과 같은지 확인
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "class/lcd/FontPartition.h"
+#include "class/lcd/PackedFont.h"
+#include "class/lcd/StaticText.h"
+
+static char path[64];
+
+void setUp() {
+    strcpy(path, "/tmp/lfnt_XXXXXX");
+    int fd = mkstemp(path);
+    if (fd >= 0) close(fd);
+}
+
+void tearDown() {
+    unlink(path);
+}
+
+// 구간 1개 = (첫 코드포인트, 글리프 수, 폭), 글리프 n 의 바이트는 모두 seed + n
+struct TestRange {
+    uint32_t first;
+    uint16_t count;
+    uint8_t width;
+    uint8_t seed;
+};
+
+static const TestRange RANGES[] = {
+    { 0x00B0, 8, 8, 0x10 },     // Latin-1 ° ~ · (8x16)
+    { 0xAC00, 4, 16, 0x40 },    // 가 각 갂 갃
+    { 0xFFFD, 1, 16, 0x7E },    // 대체 글리프
+};
+static const uint16_t RANGE_COUNT = sizeof(RANGES) / sizeof(RANGES[0]);
+
+// build_font_partition.py write_image() 와 같은 배치 (리틀엔디언 호스트)
+static bool writeImage(const char* file, uint32_t magic = FontPartition::MAGIC, uint32_t sizeAdjust = 0) {
+    uint32_t offset = sizeof(FontPartition::Header) + RANGE_COUNT * sizeof(FontPartition::Range);
+    FontPartition::Range table[RANGE_COUNT];
+    uint32_t size = offset;
+    for (uint16_t i = 0; i < RANGE_COUNT; i++) {
+        table[i].first = RANGES[i].first;
+        table[i].count = RANGES[i].count;
+        table[i].width = RANGES[i].width;
+        table[i].stride = (RANGES[i].width + 7) / 8;
+        table[i].offset = size;
+        size += RANGES[i].count * table[i].stride * FontPartition::GLYPH_HEIGHT;
+    }
+    
+    FontPartition::Header header = { magic, FontPartition::VERSION, RANGE_COUNT,
+                                     FontPartition::GLYPH_HEIGHT, 0, size + sizeAdjust };
+    
+    FILE* f = fopen(file, "wb");
+    if (!f) return false;
+    fwrite(&header, sizeof(header), 1, f);
+    fwrite(table, sizeof(table), 1, f);
+    for (uint16_t i = 0; i < RANGE_COUNT; i++) {
+        uint16_t bytes = table[i].stride * FontPartition::GLYPH_HEIGHT;
+        for (uint16_t n = 0; n < RANGES[i].count; n++) {
+            for (uint16_t b = 0; b < bytes; b++) fputc(RANGES[i].seed + n, f);
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+static void assertGlyph(const uint8_t* glyph, uint8_t width, uint8_t value) {
+    TEST_ASSERT_NOT_NULL(glyph);
+    for (int i = 0; i < (width / 8) * FontPartition::GLYPH_HEIGHT; i++) {
+        TEST_ASSERT_EQUAL_HEX8(value, glyph[i]);
+    }
+}
+
+void test_lookup_through_mmap() {
+    TEST_ASSERT_TRUE(writeImage(path));
+    FontPartition font;
+    TEST_ASSERT_TRUE(font.begin(path));
+    TEST_ASSERT_EQUAL_UINT16(3, font.getRangeCount());
+    TEST_ASSERT_EQUAL_UINT32(13, font.getGlyphCount());
+    
+    uint8_t width = 0, stride = 0;
+    
+    // 한글 음절: 구간 안 (code - first) 번째
+    const uint8_t* glyph = font.find(0xAC02, width, stride);
+    TEST_ASSERT_EQUAL_UINT8(16, width);
+    TEST_ASSERT_EQUAL_UINT8(2, stride);
+    assertGlyph(glyph, 16, 0x42);
+    
+    // Latin-1 (8x16)
+    glyph = font.find(0x00B7, width, stride);
+    TEST_ASSERT_EQUAL_UINT8(8, width);
+    TEST_ASSERT_EQUAL_UINT8(1, stride);
+    assertGlyph(glyph, 8, 0x17);
+    
+    // 구간 사이 / 앞 / 뒤는 없음 → RemoteLCD::draw16Symbol 처럼 U+FFFD 로 대체
+    TEST_ASSERT_NULL(font.find(0xAC04, width, stride));
+    TEST_ASSERT_NULL(font.find(0x00AF, width, stride));
+    TEST_ASSERT_NULL(font.find(0x4E00, width, stride));
+    TEST_ASSERT_NULL(font.find(0x1F600, width, stride));
+    glyph = font.find(0xFFFD, width, stride);
+    TEST_ASSERT_EQUAL_UINT8(16, width);
+    assertGlyph(glyph, 16, 0x7E);
+    
+    font.end();
+    TEST_ASSERT_FALSE(font.isLoaded());
+    TEST_ASSERT_NULL(font.find(0xAC00, width, stride));
+}
+
+void test_rejects_bad_images() {
+    FontPartition font;
+    TEST_ASSERT_FALSE(font.begin("/tmp/lfnt_does_not_exist.bin"));
+    
+    TEST_ASSERT_TRUE(writeImage(path, 0x12345678));
+    TEST_ASSERT_FALSE(font.begin(path));
+    TEST_ASSERT_FALSE(font.isLoaded());
+    
+    // 헤더 크기가 실제 파일보다 큼 (잘린 이미지)
+    TEST_ASSERT_TRUE(writeImage(path, FontPartition::MAGIC, 64));
+    TEST_ASSERT_FALSE(font.begin(path));
+    
+    TEST_ASSERT_TRUE(writeImage(path));
+    TEST_ASSERT_TRUE(font.begin(path));
+}
+
+// 생성기 출력 전체: 완성형 11,172자가 자모 조합(RemoteLCD::composeHangul)과 같고 기호/대체 글리프 폭이 맞는지
+void test_generator_output_round_trip() {
+    char command[160];
+    snprintf(command, sizeof(command), "python3 tools/build_font_partition.py -o %s > /dev/null 2>&1", path);
+    if (access("tools/build_font_partition.py", R_OK) != 0 || system(command) != 0) {
+        TEST_IGNORE_MESSAGE("python3 또는 tools/build_font_partition.py 없음 (저장소 최상위에서 실행)");
+    }
+    
+    FontPartition font;
+    TEST_ASSERT_TRUE(font.begin(path));
+    
+    uint8_t width, stride;
+    for (uint32_t code = lcdtext::HANGUL_FIRST; code <= lcdtext::HANGUL_LAST; code++) {
+        const uint8_t* mapped = font.find(code, width, stride);
+        TEST_ASSERT_NOT_NULL(mapped);
+        TEST_ASSERT_EQUAL_UINT8(16, width);
+        
+        uint16_t part[3];
+        uint8_t composed[PackedFont::HANGUL_BYTES] = {};
+        lcdtext::hangulParts(code, part);
+        for (int i = 0; i < 3; i++) {
+            if (part[i]) PackedFont::orHangulPart(part[i], composed);
+        }
+        TEST_ASSERT_EQUAL_MEMORY(composed, mapped, PackedFont::HANGUL_BYTES);
+    }
+    
+    // 폭 규칙은 lcdtext::makeGlyph 와 같음
+    TEST_ASSERT_NOT_NULL(font.find(0x00B0, width, stride));     // °
+    TEST_ASSERT_EQUAL_UINT8(lcdtext::makeGlyph(0x00B0).advance, width);
+    TEST_ASSERT_NOT_NULL(font.find(0x25B2, width, stride));     // ▲
+    TEST_ASSERT_EQUAL_UINT8(lcdtext::makeGlyph(0x25B2).advance, width);
+    TEST_ASSERT_NULL(font.find(0x4E00, width, stride));
+    TEST_ASSERT_NOT_NULL(font.find(0xFFFD, width, stride));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_lookup_through_mmap);
+    RUN_TEST(test_rejects_bad_images);
+    RUN_TEST(test_generator_output_round_trip);
+    return UNITY_END();
+}
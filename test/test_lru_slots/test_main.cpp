@@ -0,0 +1,56 @@
+// LruSlots 호스트 단위 테스트: pio test -e native -f test_lru_slots
+#include <unity.h>
+#include "class/lcd/LruSlots.h"
+
+void setUp() {}
+void tearDown() {}
+
+void test_find_after_claim() {
+    LruSlots<uint16_t> slots;
+    TEST_ASSERT_TRUE(slots.allocate(4));
+
+    TEST_ASSERT_EQUAL(LruSlots<uint16_t>::NOT_FOUND, slots.find(0xAC00));
+    int16_t slot = slots.claim(0xAC00);
+    TEST_ASSERT_TRUE(slot >= 0 && slot < 4);
+    TEST_ASSERT_EQUAL(slot, slots.find(0xAC00));
+    TEST_ASSERT_EQUAL_UINT32(1, slots.getHits());
+    TEST_ASSERT_EQUAL_UINT32(1, slots.getMisses());
+}
+
+void test_evicts_least_recently_used() {
+    LruSlots<uint32_t> slots;
+    slots.allocate(3);
+    int16_t a = slots.claim(1);
+    int16_t b = slots.claim(2);
+    int16_t c = slots.claim(3);
+    TEST_ASSERT_TRUE(a != b && b != c && a != c);
+
+    // 1 을 다시 쓰면 가장 오래된 것은 2
+    slots.find(1);
+    TEST_ASSERT_EQUAL(b, slots.claim(4));
+    TEST_ASSERT_EQUAL(LruSlots<uint32_t>::NOT_FOUND, slots.find(2));
+    TEST_ASSERT_EQUAL(a, slots.find(1));
+    TEST_ASSERT_EQUAL(c, slots.find(3));
+    TEST_ASSERT_EQUAL(b, slots.find(4));
+}
+
+void test_clear_and_zero_capacity() {
+    LruSlots<uint16_t> slots;
+    slots.allocate(2);
+    slots.claim(7);
+    slots.clear();
+    TEST_ASSERT_EQUAL(LruSlots<uint16_t>::NOT_FOUND, slots.find(7));
+
+    // 용량 0 = 캐시 사용 안 함
+    TEST_ASSERT_TRUE(slots.allocate(0));
+    TEST_ASSERT_EQUAL(0, slots.getCapacity());
+    TEST_ASSERT_EQUAL(LruSlots<uint16_t>::NOT_FOUND, slots.claim(7));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_find_after_claim);
+    RUN_TEST(test_evicts_least_recently_used);
+    RUN_TEST(test_clear_and_zero_capacity);
+    return UNITY_END();
+}
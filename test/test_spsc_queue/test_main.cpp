@@ -0,0 +1,111 @@
+// SpscQueue 호스트 단위 테스트: pio test -e native -f test_spsc_queue
+#include <unity.h>
+#include <thread>
+#include "class/button/SpscQueue.h"
+
+struct Event {
+    uint32_t seq;
+    uint32_t check;     // seq 로 만든 값 (내용이 깨졌는지 확인)
+};
+
+static uint32_t makeCheck(uint32_t seq) { return seq * 2654435761u; }
+
+void setUp() {}
+void tearDown() {}
+
+void test_empty_queue() {
+    SpscQueue<int, 4> q;
+    int v;
+    TEST_ASSERT_TRUE(q.isEmpty());
+    TEST_ASSERT_FALSE(q.pop(v));
+    TEST_ASSERT_EQUAL_UINT16(4, q.capacity());
+    TEST_ASSERT_EQUAL_UINT32(0, q.size());
+}
+
+void test_full_queue_drops() {
+    SpscQueue<int, 4> q;
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(q.push(i));
+    }
+    TEST_ASSERT_FALSE(q.push(99));
+    TEST_ASSERT_EQUAL_UINT32(1, q.getDropped());
+    TEST_ASSERT_EQUAL_UINT32(4, q.size());
+    TEST_ASSERT_EQUAL_UINT32(4, q.getHighWater());
+
+    // 버린 값은 들어가지 않고 순서 유지
+    int v;
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(q.pop(v));
+        TEST_ASSERT_EQUAL_INT(i, v);
+    }
+    TEST_ASSERT_FALSE(q.pop(v));
+    TEST_ASSERT_TRUE(q.isEmpty());
+}
+
+void test_wrap_keeps_order() {
+    SpscQueue<int, 4> q;
+    int v;
+    for (int i = 0; i < 1000; i++) {
+        TEST_ASSERT_TRUE(q.push(i));
+        TEST_ASSERT_TRUE(q.push(i + 1));
+        TEST_ASSERT_TRUE(q.pop(v));
+        TEST_ASSERT_EQUAL_INT(i, v);
+        TEST_ASSERT_TRUE(q.pop(v));
+        TEST_ASSERT_EQUAL_INT(i + 1, v);
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, q.getHighWater());
+    TEST_ASSERT_EQUAL_UINT32(0, q.getDropped());
+}
+
+void test_struct_payload() {
+    SpscQueue<Event, 32> q;
+    Event in = { 7, makeCheck(7) };
+    Event out = { 0, 0 };
+    TEST_ASSERT_TRUE(q.push(in));
+    TEST_ASSERT_TRUE(q.pop(out));
+    TEST_ASSERT_EQUAL_UINT32(7, out.seq);
+    TEST_ASSERT_EQUAL_UINT32(makeCheck(7), out.check);
+}
+
+// 생산자/소비자 스레드 2개: 가득 차면 생산자가 다시 시도, 순서/내용이 모두 그대로인지
+void test_two_thread_order() {
+    static SpscQueue<Event, 32> q;
+    const uint32_t count = 200000;
+    uint32_t errors = 0;
+
+    std::thread consumer([&] {
+        Event ev;
+        uint32_t expect = 0;
+        while (expect < count) {
+            if (!q.pop(ev)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (ev.seq != expect || ev.check != makeCheck(ev.seq)) errors++;
+            expect = ev.seq + 1;
+        }
+    });
+
+    for (uint32_t i = 0; i < count;) {
+        if (q.push({ i, makeCheck(i) })) {
+            i++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+
+    TEST_ASSERT_EQUAL_UINT32(0, errors);
+    TEST_ASSERT_TRUE(q.isEmpty());
+    TEST_ASSERT_TRUE(q.getHighWater() <= 32);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_queue);
+    RUN_TEST(test_full_queue_drops);
+    RUN_TEST(test_wrap_keeps_order);
+    RUN_TEST(test_struct_payload);
+    RUN_TEST(test_two_thread_order);
+    return UNITY_END();
+}
@@ -0,0 +1,78 @@
+// VerticalCounter 호스트 단위 테스트: pio test -e native -f test_vertical_counter
+#include <unity.h>
+#include "class/button/VerticalCounter.h"
+
+void setUp() {}
+void tearDown() {}
+
+// 안정 상태를 RemoteButton::scanPort() 처럼 반전 비트로 갱신하며 표본 1개
+static uint8_t feed(VerticalCounter& counter, uint8_t& stable, uint8_t sample) {
+    uint8_t changed = counter.update(sample, stable);
+    stable ^= changed;
+    return changed;
+}
+
+void test_flips_after_four_samples() {
+    VerticalCounter counter;
+    uint8_t stable = 0;
+    for (uint8_t i = 0; i < VerticalCounter::SAMPLES - 1; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0, feed(counter, stable, 0x01));
+    }
+    TEST_ASSERT_EQUAL_HEX8(0x01, feed(counter, stable, 0x01));
+    TEST_ASSERT_EQUAL_HEX8(0x01, stable);
+
+    // 계속 눌려 있으면 더 바뀌지 않음
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0, feed(counter, stable, 0x01));
+    }
+
+    // 놓음도 4표본
+    for (uint8_t i = 0; i < VerticalCounter::SAMPLES - 1; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0, feed(counter, stable, 0x00));
+    }
+    TEST_ASSERT_EQUAL_HEX8(0x01, feed(counter, stable, 0x00));
+    TEST_ASSERT_EQUAL_HEX8(0x00, stable);
+}
+
+// 채터링: 중간에 안정 상태와 같은 표본이 오면 그 비트만 처음부터
+void test_chatter_restarts_count() {
+    VerticalCounter counter;
+    uint8_t stable = 0;
+    const uint8_t chatter[] = { 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01 };
+    for (uint8_t sample : chatter) {
+        TEST_ASSERT_EQUAL_HEX8(0, feed(counter, stable, sample));
+    }
+    TEST_ASSERT_EQUAL_HEX8(0x01, feed(counter, stable, 0x01));
+}
+
+// 비트마다 따로 셈 (한 버튼 채터링이 다른 버튼 카운트를 초기화하지 않음)
+void test_bits_count_independently() {
+    VerticalCounter counter;
+    uint8_t stable = 0;
+    TEST_ASSERT_EQUAL_HEX8(0, feed(counter, stable, 0x03));
+    TEST_ASSERT_EQUAL_HEX8(0, feed(counter, stable, 0x02));    // bit0 튐
+    TEST_ASSERT_EQUAL_HEX8(0, feed(counter, stable, 0x03));
+    TEST_ASSERT_EQUAL_HEX8(0x02, feed(counter, stable, 0x03)); // bit1 4번째
+    TEST_ASSERT_EQUAL_HEX8(0x02, stable);
+    TEST_ASSERT_EQUAL_HEX8(0, feed(counter, stable, 0x03));
+    TEST_ASSERT_EQUAL_HEX8(0x01, feed(counter, stable, 0x03)); // bit0 다시 4번
+    TEST_ASSERT_EQUAL_HEX8(0x03, stable);
+}
+
+void test_all_bits_at_once() {
+    VerticalCounter counter;
+    uint8_t stable = 0;
+    for (uint8_t i = 0; i < VerticalCounter::SAMPLES - 1; i++) {
+        feed(counter, stable, 0x1F);
+    }
+    TEST_ASSERT_EQUAL_HEX8(0x1F, feed(counter, stable, 0x1F));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_flips_after_four_samples);
+    RUN_TEST(test_chatter_restarts_count);
+    RUN_TEST(test_bits_count_independently);
+    RUN_TEST(test_all_bits_at_once);
+    return UNITY_END();
+}
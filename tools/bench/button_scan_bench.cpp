@@ -0,0 +1,106 @@
+// 버튼 스캔 벤치마크 (호스트): 핀별 읽기 + 버튼별 디바운스 vs 입력 레지스터 1회 읽기 + 세로 카운터
+//   이전: scan 당 핀 읽기 8회 (버튼 5 + 설정 콤보 3), 버튼마다 마지막 변화 시각 비교
+//   현재: GPIO_IN_REG 1회 → 5비트 마스크, VerticalCounter 로 한꺼번에 디바운스
+// 핀 읽기는 가짜 레지스터(volatile)에서. 호스트에서는 읽기 비용이 메모리 읽기 1번이라 차이가 작고,
+// ESP32 에서는 digitalRead 마다 Arduino/IDF GPIO 계층을 거치므로 읽기 횟수 차이가 실제 절약
+//
+// 빌드/실행 (저장소 최상위에서):
+//   g++ -O2 -std=gnu++17 -Isrc tools/bench/button_scan_bench.cpp -o /tmp/button_scan_bench
+//   /tmp/button_scan_bench [scan 수, 기본 10000000]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+#include "class/button/VerticalCounter.h"
+
+static const uint8_t BUTTON_COUNT = 5;
+static const uint8_t BUTTON_PINS[BUTTON_COUNT] = { 12, 13, 14, 27, 26 };
+static const int64_t DEBOUNCE_US = 50000;
+static const int64_t SCAN_US = 20000;           // loop() 주기 20ms 가정
+
+static volatile uint32_t gpioIn = 0xFFFFFFFF;   // 풀업: 1 = 놓음
+
+// Arduino digitalRead 처럼 핀 범위 확인 후 레지스터 비트 (호출마다 함수 1번)
+__attribute__((noinline)) static int pinRead(uint8_t pin) {
+    if (pin < 32) return (gpioIn >> pin) & 1;
+    return 0;
+}
+
+// 이전 방식: 핀별 읽기, 버튼마다 마지막 변화 후 디바운스 시간이 지났으면 인정
+struct PerPinScanner {
+    bool pressed[BUTTON_COUNT] = {};
+    int64_t changeUs[BUTTON_COUNT] = {};
+    uint32_t events = 0;
+
+    void scan(int64_t nowUs) {
+        for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+            bool level = pinRead(BUTTON_PINS[i]) == 0;
+            if (level != pressed[i] && nowUs - changeUs[i] >= DEBOUNCE_US) {
+                pressed[i] = level;
+                changeUs[i] = nowUs;
+                events++;
+            }
+        }
+        // 설정 콤보 (SELECT + LEFT + RIGHT) 핀 다시 읽기
+        bool combo = pinRead(12) == 0 && pinRead(27) == 0 && pinRead(14) == 0;
+        events += combo;
+    }
+};
+
+// 현재 방식: 레지스터 1회 → 마스크, 세로 카운터 (표본 간격 = 디바운스 / 4)
+struct PortScanner {
+    VerticalCounter debouncer;
+    uint8_t pressedMask = 0;
+    int64_t lastSampleUs = 0;
+    uint32_t events = 0;
+
+    void scan(int64_t nowUs) {
+        if (nowUs - lastSampleUs < DEBOUNCE_US / VerticalCounter::SAMPLES) return;
+        lastSampleUs = nowUs;
+
+        uint32_t in = ~gpioIn;
+        uint8_t sample = 0;
+        for (uint8_t i = 0; i < BUTTON_COUNT; i++) {
+            sample |= ((in >> BUTTON_PINS[i]) & 1) << i;
+        }
+        uint8_t changed = debouncer.update(sample, pressedMask);
+        pressedMask ^= changed;
+        events += __builtin_popcount(changed);
+
+        const uint8_t comboMask = (1 << 0) | (1 << 2) | (1 << 3);
+        events += (pressedMask & comboMask) == comboMask;
+    }
+};
+
+template <typename Scanner>
+static double nsPerScan(uint32_t scans, bool active, uint32_t& events) {
+    Scanner scanner;
+    int64_t nowUs = 0;
+    gpioIn = 0xFFFFFFFF;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < scans; i++) {
+        nowUs += SCAN_US;
+        if (active && i % 50 == 0) gpioIn ^= 1u << 12;   // 1초마다 SELECT 누름/놓음
+        scanner.scan(nowUs);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / scans;
+    events = scanner.events;
+    return ns;
+}
+
+int main(int argc, char** argv) {
+    uint32_t scans = argc > 1 ? (uint32_t)strtoul(argv[1], nullptr, 10) : 10000000;
+    uint32_t eventsBefore, eventsAfter;
+
+    printf("scan %u회 (%lld ms 주기), 핀 읽기/scan: 이전 8회, 현재 1회\n", scans, (long long)SCAN_US / 1000);
+    double idleBefore = nsPerScan<PerPinScanner>(scans, false, eventsBefore);
+    double idleAfter = nsPerScan<PortScanner>(scans, false, eventsAfter);
+    printf("변화 없음  이전 %5.1f ns/scan, 현재 %5.1f ns/scan\n", idleBefore, idleAfter);
+
+    double activeBefore = nsPerScan<PerPinScanner>(scans, true, eventsBefore);
+    double activeAfter = nsPerScan<PortScanner>(scans, true, eventsAfter);
+    printf("누름/놓음  이전 %5.1f ns/scan, 현재 %5.1f ns/scan (이벤트 %u / %u)\n",
+           activeBefore, activeAfter, eventsBefore, eventsAfter);
+    return 0;
+}
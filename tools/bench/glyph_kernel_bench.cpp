@@ -0,0 +1,130 @@
+// GlyphKernel::expandRow 벤치마크 (호스트): 픽셀마다 비트 검사하던 이전 blitGlyph 루프 vs 마스크 표 커널
+// 모든 글리프(영문 128 + 한글 부분 360) x 16줄, 배율 1~3. 먼저 배율 1~4 출력이 같은지 확인
+//
+// 빌드/실행 (저장소 최상위에서):
+//   g++ -O2 -std=gnu++17 -Isrc/class/lcd tools/bench/glyph_kernel_bench.cpp src/class/lcd/GlyphKernel.cpp -o /tmp/glyph_kernel_bench
+//   /tmp/glyph_kernel_bench [반복 수, 기본 2000]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include "GlyphKernel.h"
+
+// 원본 폰트 표 (Arduino 형식 그대로 포함)
+typedef uint8_t byte;
+#define PROGMEM
+#include "font/english.h"
+#include "font/kssm_font.h"
+
+static const int ROWS = 16;
+
+alignas(4) static uint16_t out[240];
+static volatile uint32_t sink;
+
+// 영문 원본은 LSB = 왼쪽 → 렌더러 형식(MSB = 왼쪽)으로
+static uint8_t reverseBits(uint8_t b) {
+    b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+    b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+    b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+    return b;
+}
+
+// 이전 blitGlyph 내부 루프: 출력 픽셀마다 원본 비트 검사
+static void bitLoop(const uint8_t* src, int width, int scale, uint16_t fg, uint16_t bg) {
+    int pixels = width * scale;
+    for (int px = 0; px < pixels; px++) {
+        int col = px / scale;
+        out[px] = (src[col >> 3] & (0x80 >> (col & 7))) ? fg : bg;
+    }
+}
+
+static uint8_t englishRows[128][16];
+static uint8_t hangulRows[360][32];
+
+static void prepareFonts() {
+    for (int c = 0; c < 128; c++) {
+        for (int r = 0; r < ROWS; r++) englishRows[c][r] = reverseBits(english[c][r]);
+    }
+    // 한글 원본: 왼쪽 8열 16바이트 + 오른쪽 8열 16바이트 → 줄 단위 2바이트
+    for (int g = 0; g < 360; g++) {
+        for (int i = 0; i < ROWS; i++) {
+            hangulRows[g][i * 2] = K_font[g][i];
+            hangulRows[g][i * 2 + 1] = K_font[g][i + 16];
+        }
+    }
+}
+
+static bool verify() {
+    uint16_t expect[240];
+    for (int scale = 1; scale <= 4; scale++) {
+        for (int g = 0; g < 360; g++) {
+            for (int r = 0; r < ROWS; r++) {
+                bitLoop(hangulRows[g] + r * 2, 16, scale, 0xF800, 0x001F);
+                memcpy(expect, out, sizeof(expect));
+                GlyphKernel::expandRow(hangulRows[g] + r * 2, 16, scale, 0xF800, 0x001F, out);
+                if (memcmp(expect, out, 16 * scale * sizeof(uint16_t)) != 0) {
+                    printf("불일치: 배율 %d 글리프 %d 줄 %d\n", scale, g, r);
+                    return false;
+                }
+            }
+        }
+        for (int c = 0; c < 128; c++) {
+            for (int r = 0; r < ROWS; r++) {
+                bitLoop(englishRows[c] + r, 8, scale, 0xF800, 0x001F);
+                memcpy(expect, out, sizeof(expect));
+                GlyphKernel::expandRow(englishRows[c] + r, 8, scale, 0xF800, 0x001F, out);
+                if (memcmp(expect, out, 8 * scale * sizeof(uint16_t)) != 0) {
+                    printf("불일치: 배율 %d 영문 %d 줄 %d\n", scale, c, r);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int passes = argc > 1 ? atoi(argv[1]) : 2000;
+
+    prepareFonts();
+    if (!verify()) return 1;
+    printf("배율 1~4 출력 동일 (영문 128, 한글 부분 360)\n");
+
+    for (int scale = 1; scale <= 3; scale++) {
+        for (int k = 0; k < 2; k++) {
+            bool hangul = k == 1;
+            int count = hangul ? 360 : 128;
+            int width = hangul ? 16 : 8;
+            int stride = hangul ? 2 : 1;
+            int glyphBytes = hangul ? 32 : 16;
+            const uint8_t* base = hangul ? &hangulRows[0][0] : &englishRows[0][0];
+
+            auto t0 = std::chrono::steady_clock::now();
+            for (int n = 0; n < passes; n++) {
+                for (int g = 0; g < count; g++) {
+                    for (int r = 0; r < ROWS; r++) {
+                        bitLoop(base + g * glyphBytes + r * stride, width, scale, 0xFFFF, 0);
+                        sink += out[3];
+                    }
+                }
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            for (int n = 0; n < passes; n++) {
+                for (int g = 0; g < count; g++) {
+                    for (int r = 0; r < ROWS; r++) {
+                        GlyphKernel::expandRow(base + g * glyphBytes + r * stride, width, scale, 0xFFFF, 0, out);
+                        sink += out[3];
+                    }
+                }
+            }
+            auto t2 = std::chrono::steady_clock::now();
+
+            double loopNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double)passes * count);
+            double kernelNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / ((double)passes * count);
+            printf("%s x%d: 비트 루프 %6.1f ns/글리프, 커널 %6.1f ns/글리프 (%.1f배)\n",
+                   hangul ? "K_font " : "english", scale, loopNs, kernelNs, loopNs / kernelNs);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+// PackedFont 디코딩 벤치마크 (호스트): 원본 표에서 렌더러 형식으로 변환 vs 압축 표 디코딩
+// 먼저 488개 글리프(영문 128 + 한글 부분 360)가 원본과 바이트 단위로 같은지 확인
+// (font/packed_font.h 를 다시 생성했으면 같은 --variant 의 kssm_font.h 와 비교됨)
+//
+// 빌드/실행 (저장소 최상위에서):
+//   g++ -O2 -std=gnu++17 -Isrc/class/lcd tools/bench/packed_font_bench.cpp src/class/lcd/PackedFont.cpp -o /tmp/packed_font_bench
+//   /tmp/packed_font_bench [반복 수, 기본 20000]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include "PackedFont.h"
+
+// 원본 폰트 표 (Arduino 형식 그대로 포함)
+typedef uint8_t byte;
+#define PROGMEM
+#include "font/english.h"
+#include "font/kssm_font.h"
+
+static volatile uint32_t sink;
+
+static uint8_t reverseBits(uint8_t b) {
+    b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+    b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+    b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+    return b;
+}
+
+// 압축 전 렌더러가 하던 변환: 영문 비트 뒤집기, 한글 왼쪽/오른쪽 반 → 줄 단위
+static void rawEnglish(uint8_t ch, uint8_t* glyph) {
+    for (int i = 0; i < PackedFont::ENGLISH_BYTES; i++) glyph[i] = reverseBits(english[ch][i]);
+}
+
+static void rawHangul(uint16_t index, uint8_t* glyph) {
+    for (int i = 0; i < 16; i++) {
+        glyph[i * 2] = K_font[index][i];
+        glyph[i * 2 + 1] = K_font[index][i + 16];
+    }
+}
+
+static bool verify() {
+    uint8_t expect[PackedFont::HANGUL_BYTES];
+    uint8_t glyph[PackedFont::HANGUL_BYTES];
+
+    for (int c = 0; c < 128; c++) {
+        rawEnglish(c, expect);
+        PackedFont::decodeEnglish(c, glyph);
+        if (memcmp(expect, glyph, PackedFont::ENGLISH_BYTES) != 0) {
+            printf("영문 불일치: %d\n", c);
+            return false;
+        }
+    }
+    for (int g = 0; g < 360; g++) {
+        rawHangul(g, expect);
+        memset(glyph, 0, sizeof(glyph));
+        PackedFont::orHangulPart(g, glyph);
+        if (memcmp(expect, glyph, PackedFont::HANGUL_BYTES) != 0) {
+            printf("한글 불일치: %d\n", g);
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename F>
+static double nsPerGlyph(int passes, int count, F&& decode) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < passes; n++) {
+        for (int g = 0; g < count; g++) decode(g);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() /
+           ((double)passes * count);
+}
+
+int main(int argc, char** argv) {
+    int passes = argc > 1 ? atoi(argv[1]) : 20000;
+
+    if (!verify()) return 1;
+    printf("488개 글리프 원본과 동일\n");
+
+    uint8_t glyph[PackedFont::HANGUL_BYTES];
+    double englishRaw = nsPerGlyph(passes, 128, [&](int c) { rawEnglish(c, glyph); sink += glyph[5]; });
+    double englishPacked = nsPerGlyph(passes, 128, [&](int c) { PackedFont::decodeEnglish(c, glyph); sink += glyph[5]; });
+    double hangulRaw = nsPerGlyph(passes, 360, [&](int g) { rawHangul(g, glyph); sink += glyph[5]; });
+    double hangulPacked = nsPerGlyph(passes, 360, [&](int g) {
+        memset(glyph, 0, sizeof(glyph));
+        PackedFont::orHangulPart(g, glyph);
+        sink += glyph[5];
+    });
+
+    printf("english: 원본 변환 %5.1f ns/글리프, 압축 디코딩 %5.1f ns/글리프\n", englishRaw, englishPacked);
+    printf("K_font : 원본 변환 %5.1f ns/글리프, 압축 디코딩 %5.1f ns/글리프\n", hangulRaw, hangulPacked);
+    return 0;
+}
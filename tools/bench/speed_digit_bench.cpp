@@ -0,0 +1,77 @@
+// 속도 큰 숫자 SPI 비용 모델 (호스트): 이전 내장 5x7 폰트 4배 출력 vs BigDigitFont 바뀐 칸만 덮어쓰기
+//   이전: 위젯 160x35 지우기 + 켜진 원본 픽셀마다 4x4 fillRect (Adafruit drawChar 배율 경로)
+//   현재: 세 칸 오른쪽 정렬, 바뀐 칸만 24x32 주소창 1회 (배경 포함), 빈칸은 fillRect 1회
+// 주소창 1회 = 명령/주소 11바이트 + 픽셀당 2바이트, 창마다 고정 오버헤드 2us (CS/DC 전환, 드라이버 호출)
+// 갱신 기록: 0 → 60 → 0 km/h 1씩 (122회). 픽셀 수는 실제 비트맵에서 셈 (4x4 블록 = 원본 1픽셀)
+//
+// 빌드/실행 (저장소 최상위에서):
+//   g++ -O2 -std=gnu++17 -Isrc/class/lcd tools/bench/speed_digit_bench.cpp src/class/lcd/BigDigitFont.cpp -o /tmp/speed_digit_bench
+//   /tmp/speed_digit_bench [SPI MHz, 기본 40]
+#include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+#include "BigDigitFont.h"
+
+static const int OLD_CLEAR_W = 160;     // 이전 speedWidget 영역
+static const int OLD_CLEAR_H = 35;
+static const int OLD_SCALE = 4;         // classicDigitSize(배율 2) = 5x7 폰트 4배
+static const int DIGITS = 3;
+static const double WINDOW_US = 2.0;
+
+struct SpiCost {
+    long windows = 0;
+    long bytes = 0;
+
+    void window(long pixels) {
+        windows++;
+        bytes += 11 + 2 * pixels;
+    }
+    double us(double mhz) const { return windows * WINDOW_US + bytes * 8.0 / mhz; }
+};
+
+// 원본 5x7 켜진 픽셀 수 = 확대 비트맵 켜진 픽셀 / (4 x 4)
+static int sourcePixels(uint8_t digit) {
+    const uint8_t* glyph = BigDigitFont::glyph(digit);
+    int lit = 0;
+    for (int i = 0; i < BigDigitFont::GLYPH_BYTES; i++) lit += __builtin_popcount(glyph[i]);
+    return lit / (BigDigitFont::SCALE * BigDigitFont::SCALE);
+}
+
+int main(int argc, char** argv) {
+    double mhz = argc > 1 ? atof(argv[1]) : 40.0;
+
+    int trace[122];
+    int updates = 0;
+    for (int s = 0; s <= 60; s++) trace[updates++] = s;
+    for (int s = 60; s >= 0; s--) trace[updates++] = s;
+
+    SpiCost before, after;
+    char shown[DIGITS] = {};
+
+    for (int i = 0; i < updates; i++) {
+        char text[8];
+
+        // 이전: 영역 지우기 + 글자마다 켜진 픽셀당 4x4 사각형
+        before.window(OLD_CLEAR_W * OLD_CLEAR_H);
+        snprintf(text, sizeof(text), "%d", trace[i]);
+        for (const char* p = text; *p; p++) {
+            int lit = sourcePixels(*p - '0');
+            for (int k = 0; k < lit; k++) before.window(OLD_SCALE * OLD_SCALE);
+        }
+
+        // 현재: RemoteLCD::drawSpeedDigits 와 같은 칸 비교
+        snprintf(text, sizeof(text), "%*d", DIGITS, trace[i]);
+        for (int c = 0; c < DIGITS; c++) {
+            if (text[c] == shown[c]) continue;
+            shown[c] = text[c];
+            after.window(BigDigitFont::CELL_WIDTH * BigDigitFont::CELL_HEIGHT);
+        }
+    }
+
+    printf("갱신 %d회 (0 → 60 → 0 km/h), SPI %.0f MHz, 주소창당 %.0f us\n", updates, mhz, WINDOW_US);
+    printf("이전: 주소창 %5ld회, %8ld 바이트, 갱신당 %.2f ms\n",
+           before.windows, before.bytes, before.us(mhz) / updates / 1000);
+    printf("현재: 주소창 %5ld회, %8ld 바이트, 갱신당 %.2f ms\n",
+           after.windows, after.bytes, after.us(mhz) / updates / 1000);
+    return 0;
+}
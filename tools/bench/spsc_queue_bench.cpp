@@ -0,0 +1,122 @@
+// SpscQueue 처리량 벤치마크 (호스트): SpscQueue<T, 32> vs std::mutex + std::deque (같은 32칸 제한)
+//
+// 빌드/실행 (저장소 최상위에서):
+//   g++ -O2 -std=gnu++17 -pthread -Isrc tools/bench/spsc_queue_bench.cpp -o /tmp/spsc_queue_bench
+//   /tmp/spsc_queue_bench [이벤트 수, 기본 2000000]
+//
+// 가득/빈 큐에서는 std::this_thread::yield() (CPU 1개 환경에서도 끝나도록)
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "class/button/SpscQueue.h"
+
+struct Event {
+    uint32_t seq;
+    uint32_t check;
+};
+
+static const uint32_t DEPTH = 32;
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 생산자/소비자 스레드 2개, 초당 이벤트 수 (M/s)
+static double spscTwoThreads(uint32_t count) {
+    static SpscQueue<Event, DEPTH> q;
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread consumer([&] {
+        Event ev;
+        uint32_t got = 0;
+        while (got < count) {
+            if (q.pop(ev)) got++;
+            else std::this_thread::yield();
+        }
+    });
+    for (uint32_t i = 0; i < count;) {
+        if (q.push({ i, 0 })) i++;
+        else std::this_thread::yield();
+    }
+    consumer.join();
+    return count / seconds(start) / 1e6;
+}
+
+static double mutexTwoThreads(uint32_t count) {
+    std::mutex lock;
+    std::deque<Event> q;
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread consumer([&] {
+        uint32_t got = 0;
+        while (got < count) {
+            bool ok;
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                ok = !q.empty();
+                if (ok) {
+                    q.pop_front();
+                    got++;
+                }
+            }
+            if (!ok) std::this_thread::yield();
+        }
+    });
+    for (uint32_t i = 0; i < count;) {
+        bool ok;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            ok = q.size() < DEPTH;
+            if (ok) {
+                q.push_back({ i, 0 });
+                i++;
+            }
+        }
+        if (!ok) std::this_thread::yield();
+    }
+    consumer.join();
+    return count / seconds(start) / 1e6;
+}
+
+// 스레드 1개 push + pop 1쌍 (ns)
+static double spscSingle(uint32_t count) {
+    static SpscQueue<Event, DEPTH> q;
+    Event ev;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+        q.push({ i, 0 });
+        q.pop(ev);
+    }
+    return seconds(start) * 1e9 / count;
+}
+
+static double mutexSingle(uint32_t count) {
+    std::mutex lock;
+    std::deque<Event> q;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; i++) {
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            q.push_back({ i, 0 });
+        }
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            q.pop_front();
+        }
+    }
+    return seconds(start) * 1e9 / count;
+}
+
+int main(int argc, char** argv) {
+    uint32_t count = argc > 1 ? (uint32_t)strtoul(argv[1], nullptr, 10) : 2000000;
+
+    printf("이벤트 %u개, 큐 %u칸\n", count, DEPTH);
+    printf("2스레드   SpscQueue %6.1f M/s   mutex+deque %6.1f M/s\n",
+           spscTwoThreads(count), mutexTwoThreads(count));
+    printf("1스레드   SpscQueue %6.2f ns    mutex+deque %6.2f ns  (push+pop 1쌍)\n",
+           spscSingle(count * 10), mutexSingle(count * 10));
+    return 0;
+}
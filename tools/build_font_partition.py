@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+"""확장 16x16 폰트 파티션 이미지 생성 (FontPartition 형식, "LFNT" v1)
+
+포함 글리프:
+  - 한글 완성형 11,172자 (U+AC00~U+D7A3): kssm_font.h 자모를 RemoteLCD 와 같은 규칙으로 조합
+  - UI 기호 (● ▲ ▼ ° 등): 내장 비트맵
+  - U+FFFD: 대체 글리프 (빈 사각형)
+  - --ttf 지정 시: Latin-1 (U+00A0~U+00FF, 8x16) 과 기호 블록 (16x16) 을 글꼴에서 래스터화 (Pillow 필요)
+
+폭 규칙은 lcdtext::makeGlyph 와 같아야 한다: U+0080~U+00FF 는 8픽셀, 그 외 16픽셀.
+
+기록:
+  python3 tools/build_font_partition.py -o font.bin [--ttf NanumGothic.ttf]
+  esptool.py --chip esp32 write_flash 0x290000 font.bin   (partitions.csv 의 font 오프셋)
+생성된 font.bin 은 저장소에 넣지 않는다.
+"""
+import argparse
+import os
+import re
+import struct
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+FONT_DIR = os.path.join(ROOT, 'src', 'class', 'lcd', 'font')
+
+MAGIC = 0x544E464C
+VERSION = 1
+HEIGHT = 16
+HEADER_SIZE = 16
+RANGE_SIZE = 12
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+# StaticText.h 와 동일
+CHO_TYPE_NO_JONG = [0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 3, 3, 1, 2, 4, 4, 4, 2, 1, 3, 0]
+CHO_TYPE_JONG = [0, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 7, 6, 6, 7, 7, 7, 6, 6, 7, 5]
+JONG_TYPE = [0, 0, 2, 0, 2, 1, 2, 1, 2, 3, 0, 2, 1, 3, 3, 1, 2, 1, 3, 3, 1, 1]
+
+# --ttf 로 래스터화할 기호 구간 (16x16)
+SYMBOL_BLOCKS = [
+    (0x2190, 0x21FF),   # 화살표
+    (0x2200, 0x22FF),   # 수학 기호
+    (0x25A0, 0x25FF),   # 도형
+    (0x2600, 0x26FF),   # 기타 기호
+]
+
+
+def glyph_width(code):
+    return 8 if code < 0x100 else 16
+
+
+def parse_table(path, start, count, size):
+    text = open(path, encoding='utf-8').read()
+    begin = text.index(start)
+    body = text[text.index('{', begin) + 1:text.index('};', begin)]
+    body = re.sub(r'//[^\n]*', '', body)
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    values = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{2}', body)]
+    if len(values) != count * size:
+        raise SystemExit('%s: %d 바이트 (예상 %d)' % (path, len(values), count * size))
+    return [values[i * size:(i + 1) * size] for i in range(count)]
+
+
+def hangul_parts(code):
+    index = code - HANGUL_FIRST
+    last = index % 28
+    index //= 28
+    first = index // 21 + 1
+    mid = index % 21 + 1
+    if last == 0:
+        first_type = CHO_TYPE_NO_JONG[mid]
+        mid_type = 0 if first in (1, 24) else 1
+        last_type = 0
+    else:
+        first_type = CHO_TYPE_JONG[mid]
+        mid_type = 2 if first in (1, 24) else 3
+        last_type = JONG_TYPE[mid]
+    return (first_type * 20 + first,
+            160 + mid_type * 22 + mid,
+            248 + last_type * 28 + last if last else 0)
+
+
+def compose_hangul(kfont, code):
+    rows = []
+    parts = hangul_parts(code)
+    for i in range(16):
+        rows.append(kfont[parts[0]][i] | kfont[parts[1]][i] | kfont[parts[2]][i])
+        rows.append(kfont[parts[0]][i + 16] | kfont[parts[1]][i + 16] | kfont[parts[2]][i + 16])
+    return bytes(rows)
+
+
+def from_pixels(width, on):
+    """on(x, y) -> bool 로 1bpp 비트맵 생성"""
+    stride = (width + 7) // 8
+    data = bytearray(stride * HEIGHT)
+    for y in range(HEIGHT):
+        for x in range(width):
+            if on(x, y):
+                data[y * stride + x // 8] |= 0x80 >> (x % 8)
+    return bytes(data)
+
+
+def builtin_symbols():
+    glyphs = {}
+    # ● 검은 원
+    glyphs[0x25CF] = from_pixels(16, lambda x, y: (x - 7.5) ** 2 + (y - 7.5) ** 2 <= 36)
+    # ○ 흰 원
+    glyphs[0x25CB] = from_pixels(16, lambda x, y: 25 <= (x - 7.5) ** 2 + (y - 7.5) ** 2 <= 42)
+    # ▲ / ▼ (높이 11, 밑변 13)
+    glyphs[0x25B2] = from_pixels(16, lambda x, y: 2 <= y <= 12 and abs(x - 7.5) <= (y - 2) * 0.6 + 0.5)
+    glyphs[0x25BC] = from_pixels(16, lambda x, y: 3 <= y <= 13 and abs(x - 7.5) <= (13 - y) * 0.6 + 0.5)
+    # ◀ / ▶
+    glyphs[0x25C0] = from_pixels(16, lambda x, y: 2 <= x <= 12 and abs(y - 7.5) <= (x - 2) * 0.6 + 0.5)
+    glyphs[0x25B6] = from_pixels(16, lambda x, y: 3 <= x <= 13 and abs(y - 7.5) <= (13 - x) * 0.6 + 0.5)
+    # ■ / □
+    glyphs[0x25A0] = from_pixels(16, lambda x, y: 2 <= x <= 13 and 2 <= y <= 13)
+    glyphs[0x25A1] = from_pixels(16, lambda x, y: 2 <= x <= 13 and 2 <= y <= 13 and
+                                 (x in (2, 13) or y in (2, 13)))
+    # ° (8x16)
+    glyphs[0x00B0] = from_pixels(8, lambda x, y: 3 <= (x - 3.5) ** 2 + (y - 4) ** 2 <= 7)
+    # · (8x16)
+    glyphs[0x00B7] = from_pixels(8, lambda x, y: 3 <= x <= 4 and 7 <= y <= 8)
+    # U+FFFD 대체 글리프: 빈 사각형
+    glyphs[0xFFFD] = from_pixels(16, lambda x, y: 2 <= x <= 13 and 1 <= y <= 14 and
+                                 (x in (2, 13) or y in (1, 14)))
+    return glyphs
+
+
+def rasterize_ttf(path, codes):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        raise SystemExit('--ttf 사용에는 Pillow 필요 (pip install pillow)')
+
+    font = ImageFont.truetype(path, 15)
+    glyphs = {}
+    for code in codes:
+        ch = chr(code)
+        # 글꼴에 없는 글자 제외 (.notdef 상자)
+        if hasattr(font, 'getmask') and font.getmask(ch).getbbox() is None:
+            continue
+        width = glyph_width(code)
+        image = Image.new('1', (width, HEIGHT), 0)
+        draw = ImageDraw.Draw(image)
+        left, top, right, bottom = draw.textbbox((0, 0), ch, font=font)
+        draw.text(((width - (right - left)) // 2 - left, (HEIGHT - 15) // 2), ch, fill=1, font=font)
+        pixels = image.load()
+        glyphs[code] = from_pixels(width, lambda x, y: pixels[x, y])
+    return glyphs
+
+
+def build_ranges(glyphs):
+    codes = sorted(glyphs)
+    ranges = []
+    for code in codes:
+        width = glyph_width(code)
+        last = ranges[-1] if ranges else None
+        if last and last[0] + len(last[2]) == code and last[1] == width and len(last[2]) < 0xFFFF:
+            last[2].append(glyphs[code])
+        else:
+            ranges.append([code, width, [glyphs[code]]])
+    return ranges
+
+
+def write_image(path, glyphs):
+    ranges = build_ranges(glyphs)
+    offset = HEADER_SIZE + RANGE_SIZE * len(ranges)
+    table = b''
+    bitmaps = b''
+    for first, width, items in ranges:
+        stride = (width + 7) // 8
+        table += struct.pack('<IHBBI', first, len(items), width, stride, offset + len(bitmaps))
+        for bitmap in items:
+            assert len(bitmap) == stride * HEIGHT
+            bitmaps += bitmap
+    size = offset + len(bitmaps)
+    header = struct.pack('<IHHHHI', MAGIC, VERSION, len(ranges), HEIGHT, 0, size)
+    with open(path, 'wb') as f:
+        f.write(header + table + bitmaps)
+    return len(ranges), size
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('-o', '--output', default='font.bin')
+    parser.add_argument('--variant', default='005', choices=['005', '016', '132'])
+    parser.add_argument('--ttf', help='Latin-1 / 기호 래스터화용 TrueType 글꼴')
+    parser.add_argument('--max-size', type=lambda v: int(v, 0), default=0x80000,
+                        help='파티션 크기 (기본 0x80000)')
+    args = parser.parse_args()
+
+    kfont = parse_table(os.path.join(FONT_DIR, 'kssm_font.h'),
+                        '#ifdef KSX1001_' + args.variant, 360, 32)
+
+    glyphs = {}
+    for code in range(HANGUL_FIRST, HANGUL_LAST + 1):
+        glyphs[code] = compose_hangul(kfont, code)
+
+    if args.ttf:
+        codes = list(range(0xA0, 0x100))
+        for first, last in SYMBOL_BLOCKS:
+            codes += range(first, last + 1)
+        glyphs.update(rasterize_ttf(args.ttf, codes))
+
+    # 내장 기호는 항상 포함 (UI 가 쓰는 글자 모양 고정)
+    glyphs.update(builtin_symbols())
+
+    count, size = write_image(args.output, glyphs)
+    if size > args.max_size:
+        raise SystemExit('%s: %d 바이트 - 파티션(%d) 초과' % (args.output, size, args.max_size))
+    print('%s: 글리프 %d, 구간 %d, %d 바이트' % (args.output, len(glyphs), count, size))
+
+
+if __name__ == '__main__':
+    main()
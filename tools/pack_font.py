@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""16x16 한글 / 8x16 영문 폰트 압축 (바이트 마스크 형식)
+
+src/class/lcd/font/kssm_font.h, english.h 의 원본 비트맵을 읽어
+src/class/lcd/font/packed_font.h 를 생성한다.
+
+형식 (글리프마다):
+  마스크 (영문 2바이트 / 한글 4바이트, 리틀엔디언) - 비트 i = 글리프 바이트 i 가 0이 아님
+  0이 아닌 바이트들 (순서대로)
+  + 글리프 시작 오프셋 표 (uint16)
+
+글리프 바이트는 RemoteLCD 가 쓰는 형식으로 미리 변환해 둔다.
+  영문: 줄 단위 1바이트, MSB = 왼쪽 (원본은 LSB = 왼쪽)
+  한글: 줄 단위 2바이트 (원본은 왼쪽 8열 16바이트 + 오른쪽 8열 16바이트)
+
+사용법: python3 tools/pack_font.py [--variant 005|016|132]
+"""
+import argparse
+import os
+import re
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+FONT_DIR = os.path.join(ROOT, 'src', 'class', 'lcd', 'font')
+
+
+def parse_table(path, start, count, size):
+    text = open(path, encoding='utf-8').read()
+    begin = text.index(start)
+    body = text[text.index('{', begin) + 1:text.index('};', begin)]
+    body = re.sub(r'//[^\n]*', '', body)
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    values = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{2}', body)]
+    if len(values) != count * size:
+        raise SystemExit('%s: %d 바이트 (예상 %d)' % (path, len(values), count * size))
+    return [values[i * size:(i + 1) * size] for i in range(count)]
+
+
+def reverse_bits(b):
+    return int('{:08b}'.format(b)[::-1], 2)
+
+
+def english_rows(glyph):
+    return [reverse_bits(b) for b in glyph]
+
+
+def hangul_rows(glyph):
+    rows = []
+    for i in range(16):
+        rows += [glyph[i], glyph[i + 16]]
+    return rows
+
+
+def pack(glyphs, mask_bytes):
+    data = []
+    offsets = []
+    for glyph in glyphs:
+        offsets.append(len(data))
+        mask = 0
+        for i, b in enumerate(glyph):
+            if b:
+                mask |= 1 << i
+        data += [(mask >> (8 * k)) & 0xFF for k in range(mask_bytes)]
+        data += [b for b in glyph if b]
+    if len(data) > 0xFFFF:
+        raise SystemExit('오프셋이 uint16 범위를 넘음')
+    return offsets, data
+
+
+def c_array(ctype, name, values, per_line):
+    fmt = '0x%04X' if ctype == 'uint16_t' else '0x%02X'
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('  ' + ','.join(fmt % v for v in values[i:i + per_line]) + ',')
+    return 'const %s %s[%d] = {\n%s\n};\n' % (ctype, name, len(values), '\n'.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--variant', default='005', choices=['005', '016', '132'])
+    args = parser.parse_args()
+
+    kfont = parse_table(os.path.join(FONT_DIR, 'kssm_font.h'),
+                        '#ifdef KSX1001_' + args.variant, 360, 32)
+    english = parse_table(os.path.join(FONT_DIR, 'english.h'), 'english[128][16]', 128, 16)
+
+    k_offsets, k_data = pack([hangul_rows(g) for g in kfont], 4)
+    e_offsets, e_data = pack([english_rows(g) for g in english], 2)
+
+    raw = 360 * 32 + 128 * 16
+    packed = len(k_data) + 2 * len(k_offsets) + len(e_data) + 2 * len(e_offsets)
+
+    out = []
+    out.append('// 자동 생성 파일 - 직접 수정하지 말 것 (tools/pack_font.py --variant %s)\n' % args.variant)
+    out.append('// 원본 %d 바이트 → %d 바이트 (한글 %d + 영문 %d, 오프셋 표 포함)\n'
+               % (raw, packed, len(k_data) + 2 * len(k_offsets), len(e_data) + 2 * len(e_offsets)))
+    out.append('#ifndef PACKED_FONT_DATA_H\n#define PACKED_FONT_DATA_H\n\n#include <stdint.h>\n\n')
+    out.append('// 한글 자모 360개 (KSX1001_%s), 마스크 4바이트\n' % args.variant)
+    out.append(c_array('uint16_t', 'PACKED_KFONT_OFFSET', k_offsets, 12))
+    out.append(c_array('uint8_t', 'PACKED_KFONT_DATA', k_data, 16))
+    out.append('\n// 영문 128자, 마스크 2바이트\n')
+    out.append(c_array('uint16_t', 'PACKED_ENGLISH_OFFSET', e_offsets, 12))
+    out.append(c_array('uint8_t', 'PACKED_ENGLISH_DATA', e_data, 16))
+    out.append('\n#endif // PACKED_FONT_DATA_H\n')
+
+    path = os.path.join(FONT_DIR, 'packed_font.h')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(''.join(out))
+    print('%s: %d → %d 바이트 (%d 절약)' % (os.path.relpath(path, ROOT), raw, packed, raw - packed))
+
+
+if __name__ == '__main__':
+    main()